@@ -0,0 +1,114 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "benchmark.h"
+
+#include <mayaUsdUtils/DiffCore.h>
+
+#include <vector>
+
+using namespace MayaUsdBenchmark;
+
+namespace {
+
+// A million points, UVs or colors: what the exporters diff per dense mesh.
+constexpr size_t kCount = 1 << 20;
+
+// Equal arrays are the worst case, every element is compared.
+class CompareFloatArrays : public Fixture
+{
+public:
+    CompareFloatArrays()
+        : _input0(3 * kCount)
+        , _input1(3 * kCount)
+    {
+        for (size_t i = 0; i < _input0.size(); ++i) {
+            _input0[i] = _input1[i] = float(i % 1021) * 0.25f;
+        }
+    }
+
+    void Run() override
+    {
+        _result = MayaUsdUtils::compareArray(
+            _input0.data(), _input1.data(), _input0.size(), _input1.size());
+        DoNotOptimize(&_result);
+    }
+
+private:
+    std::vector<float> _input0;
+    std::vector<float> _input1;
+    bool _result = false;
+};
+
+MAYAUSD_BENCHMARK(CompareFloatArrays, "DiffCore/compareArray/float", 3 * kCount);
+
+class Vec3AreAllTheSame : public Fixture
+{
+public:
+    Vec3AreAllTheSame()
+        : _input(3 * kCount)
+    {
+        for (size_t i = 0; i < kCount; ++i) {
+            _input[3 * i] = 0.5f;
+            _input[3 * i + 1] = 0.25f;
+            _input[3 * i + 2] = 1.0f;
+        }
+    }
+
+    void Run() override
+    {
+        _result = MayaUsdUtils::vec3AreAllTheSame(_input.data(), kCount);
+        DoNotOptimize(&_result);
+    }
+
+private:
+    std::vector<float> _input;
+    bool _result = false;
+};
+
+MAYAUSD_BENCHMARK(Vec3AreAllTheSame, "DiffCore/vec3AreAllTheSame/float", kCount);
+
+// Maya's separate U and V arrays against USD's interleaved UVs.
+class CompareUvArrays : public Fixture
+{
+public:
+    CompareUvArrays()
+        : _u(kCount)
+        , _v(kCount)
+        , _uv(2 * kCount)
+    {
+        for (size_t i = 0; i < kCount; ++i) {
+            _uv[2 * i] = _u[i] = float(i % 509) / 509.0f;
+            _uv[2 * i + 1] = _v[i] = float(i % 257) / 257.0f;
+        }
+    }
+
+    void Run() override
+    {
+        _result = MayaUsdUtils::compareUvArray(
+            _u.data(), _v.data(), _uv.data(), kCount, kCount);
+        DoNotOptimize(&_result);
+    }
+
+private:
+    std::vector<float> _u;
+    std::vector<float> _v;
+    std::vector<float> _uv;
+    bool _result = false;
+};
+
+MAYAUSD_BENCHMARK(CompareUvArrays, "DiffCore/compareUvArray", kCount);
+
+} // namespace
@@ -0,0 +1,202 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "benchmark.h"
+
+#include <mayaUsd/utils/util.h>
+
+#include <maya/MFloatPointArray.h>
+#include <maya/MFnMesh.h>
+#include <maya/MFnMeshData.h>
+#include <maya/MIntArray.h>
+#include <maya/MObject.h>
+
+#include <pxr/base/gf/vec2f.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/usd/usdGeom/tokens.h>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+using namespace MayaUsdBenchmark;
+
+namespace {
+
+// A grid of kGridSize x kGridSize quads, about a million face vertices: the
+// size of a dense character or environment mesh.
+constexpr int kGridSize = 512;
+constexpr int kNumVertices = (kGridSize + 1) * (kGridSize + 1);
+constexpr int kNumFaces = kGridSize * kGridSize;
+constexpr int kNumFaceVertices = 4 * kNumFaces;
+
+// Calls fn(faceVertex, face, vertex) for every face vertex of the grid.
+template <typename FnT>
+void forEachFaceVertex(FnT fn)
+{
+    int faceVertex = 0;
+    for (int y = 0; y < kGridSize; ++y) {
+        for (int x = 0; x < kGridSize; ++x) {
+            const int face = y * kGridSize + x;
+            const int corner = y * (kGridSize + 1) + x;
+            fn(faceVertex++, face, corner);
+            fn(faceVertex++, face, corner + 1);
+            fn(faceVertex++, face, corner + kGridSize + 2);
+            fn(faceVertex++, face, corner + kGridSize + 1);
+        }
+    }
+}
+
+// Face varying UVs as read per face vertex from Maya, where the face vertices
+// of a vertex share their value: merging shrinks the values to one per vertex.
+class MergeEquivalentUVs : public Fixture
+{
+public:
+    MergeEquivalentUVs()
+        : _sourceValues(kNumFaceVertices)
+        , _sourceIndices(kNumFaceVertices)
+    {
+        forEachFaceVertex([this](int faceVertex, int, int vertex) {
+            _sourceValues[faceVertex] = GfVec2f(
+                float(vertex % (kGridSize + 1)) / kGridSize,
+                float(vertex / (kGridSize + 1)) / kGridSize);
+            _sourceIndices[faceVertex] = faceVertex;
+        });
+    }
+
+    void SetUp() override
+    {
+        // Detach from the source data, so that Run() doesn't pay for a copy.
+        _values = _sourceValues;
+        _values.data();
+        _indices = _sourceIndices;
+        _indices.data();
+    }
+
+    void Run() override
+    {
+        UsdMayaUtil::MergeEquivalentIndexedValues(&_values, &_indices);
+        DoNotOptimize(_values.cdata());
+    }
+
+private:
+    VtVec2fArray _sourceValues;
+    VtIntArray _sourceIndices;
+    VtVec2fArray _values;
+    VtIntArray _indices;
+};
+
+MAYAUSD_BENCHMARK(MergeEquivalentUVs, "MergeEquivalentIndexedValues/uvs", kNumFaceVertices);
+
+// Face varying normals of a faceted mesh: merging shrinks the values to one
+// per face.
+class MergeEquivalentNormals : public Fixture
+{
+public:
+    MergeEquivalentNormals()
+        : _sourceValues(kNumFaceVertices)
+        , _sourceIndices(kNumFaceVertices)
+    {
+        forEachFaceVertex([this](int faceVertex, int face, int) {
+            _sourceValues[faceVertex] = GfVec3f(
+                float(face % 7), float(face % 11), float(face % 13)).GetNormalized();
+            _sourceIndices[faceVertex] = faceVertex;
+        });
+    }
+
+    void SetUp() override
+    {
+        // Detach from the source data, so that Run() doesn't pay for a copy.
+        _values = _sourceValues;
+        _values.data();
+        _indices = _sourceIndices;
+        _indices.data();
+    }
+
+    void Run() override
+    {
+        UsdMayaUtil::MergeEquivalentIndexedValues(&_values, &_indices);
+        DoNotOptimize(_values.cdata());
+    }
+
+private:
+    VtVec3fArray _sourceValues;
+    VtIntArray _sourceIndices;
+    VtVec3fArray _values;
+    VtIntArray _indices;
+};
+
+MAYAUSD_BENCHMARK(
+    MergeEquivalentNormals,
+    "MergeEquivalentIndexedValues/normals",
+    kNumFaceVertices);
+
+// Face varying indices that are really per vertex: the whole mesh is visited
+// before they compress to vertex interpolation.
+class CompressFaceVaryingToVertex : public Fixture
+{
+public:
+    CompressFaceVaryingToVertex()
+        : _sourceIndices(kNumFaceVertices)
+    {
+        MFloatPointArray points(kNumVertices);
+        for (int vertex = 0; vertex < kNumVertices; ++vertex) {
+            points.set(
+                vertex,
+                float(vertex % (kGridSize + 1)),
+                0.0f,
+                float(vertex / (kGridSize + 1)));
+        }
+
+        MIntArray counts(kNumFaces, 4);
+        MIntArray connects(kNumFaceVertices);
+        forEachFaceVertex([this, &connects](int faceVertex, int, int vertex) {
+            connects[faceVertex] = vertex;
+            _sourceIndices[faceVertex] = vertex;
+        });
+
+        MFnMeshData dataFn;
+        _meshData = dataFn.create();
+        _meshFn.create(kNumVertices, kNumFaces, points, counts, connects, _meshData);
+    }
+
+    void SetUp() override
+    {
+        // Detach from the source data, so that Run() doesn't pay for a copy.
+        _interpolation = UsdGeomTokens->faceVarying;
+        _indices = _sourceIndices;
+        _indices.data();
+    }
+
+    void Run() override
+    {
+        UsdMayaUtil::CompressFaceVaryingPrimvarIndices(_meshFn, &_interpolation, &_indices);
+        DoNotOptimize(_indices.cdata());
+    }
+
+private:
+    MObject _meshData;
+    MFnMesh _meshFn;
+    VtIntArray _sourceIndices;
+    TfToken _interpolation;
+    VtIntArray _indices;
+};
+
+MAYAUSD_MAYA_BENCHMARK(
+    CompressFaceVaryingToVertex,
+    "CompressFaceVaryingPrimvarIndices/vertex",
+    kNumFaceVertices);
+
+} // namespace
@@ -0,0 +1,84 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "benchmark.h"
+
+#include <hdMaya/adapters/adapter.h>
+#include <hdMaya/adapters/materialNetworkConverter.h>
+
+#include <maya/MDGModifier.h>
+#include <maya/MFnDependencyNode.h>
+#include <maya/MObject.h>
+#include <maya/MObjectArray.h>
+
+#include <pxr/imaging/hd/material.h>
+#include <pxr/usd/sdf/path.h>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+using namespace MayaUsdBenchmark;
+
+namespace {
+
+// A look-dev scene with many textured materials, all converted into the same
+// network: one lambert and one file node per material, and a place2dTexture
+// shared by all the file nodes.
+constexpr int kNumMaterials = 250;
+
+class GetMaterial : public Fixture
+{
+public:
+    GetMaterial()
+        : _prefix("/Looks")
+    {
+        HdMayaAdapter::Initialize();
+
+        MDGModifier modifier;
+        const MObject place2d = modifier.createNode("place2dTexture");
+        MObjectArray files;
+        for (int i = 0; i < kNumMaterials; ++i) {
+            _materials.append(modifier.createNode("lambert"));
+            files.append(modifier.createNode("file"));
+        }
+        modifier.doIt();
+
+        const MFnDependencyNode place2dFn(place2d);
+        for (int i = 0; i < kNumMaterials; ++i) {
+            const MFnDependencyNode materialFn(_materials[i]);
+            const MFnDependencyNode fileFn(files[i]);
+            modifier.connect(fileFn.findPlug("outColor", true), materialFn.findPlug("color", true));
+            modifier.connect(place2dFn.findPlug("outUV", true), fileFn.findPlug("uvCoord", true));
+        }
+        modifier.doIt();
+    }
+
+    void Run() override
+    {
+        HdMaterialNetwork network;
+        HdMayaMaterialNetworkConverter converter(network, _prefix);
+        for (unsigned int i = 0; i < _materials.length(); ++i) {
+            converter.GetMaterial(_materials[i]);
+        }
+        DoNotOptimize(network.nodes.data());
+    }
+
+private:
+    const SdfPath _prefix;
+    MObjectArray _materials;
+};
+
+MAYAUSD_MAYA_BENCHMARK(GetMaterial, "HdMayaMaterialNetworkConverter/GetMaterial", kNumMaterials);
+
+} // namespace
@@ -0,0 +1,107 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "benchmark.h"
+
+#include "AL/usdmaya/SelectabilityDB.h"
+
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/sdf/path.h>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+using namespace MayaUsdBenchmark;
+
+namespace {
+
+// Unselectable assets in a large set, queried for every prim of the set.
+constexpr int kNumAssets = 1000;
+constexpr int kNumPrimsPerAsset = 100;
+constexpr int kNumQueries = kNumAssets * kNumPrimsPerAsset;
+
+class IsPathUnselectable : public Fixture
+{
+public:
+    IsPathUnselectable()
+    {
+        const SdfPath set("/Set");
+        SdfPathVector unselectable;
+        for (int asset = 0; asset < kNumAssets; ++asset) {
+            const SdfPath assetPath = set.AppendChild(TfToken(TfStringPrintf("asset%d", asset)));
+            // Every other asset is unselectable.
+            if (asset % 2) {
+                unselectable.push_back(assetPath);
+            }
+
+            for (int prim = 0; prim < kNumPrimsPerAsset; ++prim) {
+                _queries.push_back(
+                    assetPath.AppendChild(TfToken("geo"))
+                        .AppendChild(TfToken(TfStringPrintf("mesh%d", prim))));
+            }
+        }
+        _db.setPathsAsUnselectable(unselectable);
+    }
+
+    void Run() override
+    {
+        _numUnselectable = 0;
+        for (const SdfPath& path : _queries) {
+            _numUnselectable += _db.isPathUnselectable(path);
+        }
+        DoNotOptimize(&_numUnselectable);
+    }
+
+private:
+    AL::usdmaya::SelectabilityDB _db;
+    SdfPathVector _queries;
+    int _numUnselectable = 0;
+};
+
+MAYAUSD_BENCHMARK(IsPathUnselectable, "SelectabilityDB/isPathUnselectable", kNumQueries);
+
+// Selection locks changed on half of the assets.
+class AddRemoveUnselectablePaths : public Fixture
+{
+public:
+    AddRemoveUnselectablePaths()
+    {
+        const SdfPath set("/Set");
+        for (int asset = 0; asset < kNumAssets; ++asset) {
+            const SdfPath assetPath = set.AppendChild(TfToken(TfStringPrintf("asset%d", asset)));
+            (asset % 2 ? _initial : _changed).push_back(assetPath);
+        }
+    }
+
+    void SetUp() override { _db.setPathsAsUnselectable(_initial); }
+
+    void Run() override
+    {
+        _db.addPathsAsUnselectable(_changed);
+        _db.removePathsAsUnselectable(_initial);
+        DoNotOptimize(&_db);
+    }
+
+private:
+    AL::usdmaya::SelectabilityDB _db;
+    SdfPathVector _initial;
+    SdfPathVector _changed;
+};
+
+MAYAUSD_BENCHMARK(
+    AddRemoveUnselectablePaths,
+    "SelectabilityDB/addRemovePathsAsUnselectable",
+    kNumAssets);
+
+} // namespace
@@ -0,0 +1,79 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "benchmark.h"
+
+#include "AL/usd/transaction/TransactionManager.h"
+
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/sdf/attributeSpec.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/usd/stage.h>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+using namespace MayaUsdBenchmark;
+using AL::usd::transaction::TransactionManager;
+
+namespace {
+
+// A small edit in a layer of many prims, e.g. an attribute change in a
+// large set.
+constexpr int kNumPrims = 100000;
+
+template <TransactionManager::TrackingMode Mode>
+class TransactionSmallEdit : public Fixture
+{
+public:
+    TransactionSmallEdit()
+        : _stage(UsdStage::CreateInMemory())
+        , _layer(SdfLayer::CreateAnonymous())
+    {
+        SdfChangeBlock block;
+        for (int i = 0; i < kNumPrims; ++i) {
+            auto prim = SdfPrimSpec::New(
+                _layer->GetPseudoRoot(), TfStringPrintf("prim_%d", i), SdfSpecifierDef);
+            auto attr = SdfAttributeSpec::New(prim, "prop", SdfValueTypeNames->Int);
+            attr->SetDefaultValue(VtValue(i));
+        }
+        _attr = _layer->GetAttributeAtPath(SdfPath(TfStringPrintf("/prim_%d.prop", kNumPrims / 2)));
+    }
+
+    ~TransactionSmallEdit() override { TransactionManager::SetTrackingMode(_previousMode); }
+
+    void Run() override
+    {
+        TransactionManager::SetTrackingMode(Mode);
+        TransactionManager::Open(_stage, _layer);
+        _attr->SetDefaultValue(VtValue(++_value));
+        TransactionManager::Close(_stage, _layer);
+    }
+
+private:
+    UsdStageRefPtr _stage;
+    SdfLayerRefPtr _layer;
+    SdfAttributeSpecHandle _attr;
+    TransactionManager::TrackingMode _previousMode = TransactionManager::GetTrackingMode();
+    int _value = 0;
+};
+
+using TransactionSmallEditJournal = TransactionSmallEdit<TransactionManager::TrackingMode::kJournal>;
+using TransactionSmallEditDiff = TransactionSmallEdit<TransactionManager::TrackingMode::kDiff>;
+
+MAYAUSD_BENCHMARK(TransactionSmallEditJournal, "TransactionManager/smallEdit/journal", kNumPrims);
+MAYAUSD_BENCHMARK(TransactionSmallEditDiff, "TransactionManager/smallEdit/diff", kNumPrims);
+
+} // namespace
@@ -0,0 +1,81 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "benchmark.h"
+
+#include <mayaUsd/ufe/Utils.h>
+
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <string>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+using namespace MayaUsdBenchmark;
+
+namespace {
+
+// Duplicating or creating prims under a parent with many children, e.g. the
+// instances of a scattered set.
+constexpr int kNumSiblings = 10000;
+
+// The siblings of the parent are known from the previous query.
+class UniqueChildNameCached : public Fixture
+{
+public:
+    UniqueChildNameCached()
+        : _stage(UsdStage::CreateInMemory())
+    {
+        _parent = _stage->DefinePrim(SdfPath("/Set"));
+        for (int i = 1; i <= kNumSiblings; ++i) {
+            _stage->DefinePrim(_parent.GetPath().AppendChild(TfToken(TfStringPrintf("cube%d", i))));
+        }
+    }
+
+    void Run() override
+    {
+        _result = MayaUsd::ufe::uniqueChildName(_parent, "cube1");
+        DoNotOptimize(&_result);
+    }
+
+protected:
+    UsdStageRefPtr _stage;
+    UsdPrim _parent;
+    std::string _result;
+};
+
+MAYAUSD_BENCHMARK(UniqueChildNameCached, "uniqueChildName/cached", 1);
+
+// A child was added or removed since the previous query.
+class UniqueChildNameAfterEdit : public UniqueChildNameCached
+{
+public:
+    void SetUp() override
+    {
+        const SdfPath extraPath = _parent.GetPath().AppendChild(TfToken("extra"));
+        if (_stage->GetPrimAtPath(extraPath)) {
+            _stage->RemovePrim(extraPath);
+        } else {
+            _stage->DefinePrim(extraPath);
+        }
+    }
+};
+
+MAYAUSD_BENCHMARK(UniqueChildNameAfterEdit, "uniqueChildName/afterEdit", kNumSiblings);
+
+} // namespace
@@ -0,0 +1,46 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "benchmark.h"
+
+#include <utility>
+
+namespace MayaUsdBenchmark {
+
+namespace {
+
+// Results are stored here, the compiler can't tell that nothing reads them.
+const void* volatile sSink = nullptr;
+
+} // namespace
+
+std::vector<Benchmark>& GetBenchmarks()
+{
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+}
+
+bool RegisterBenchmark(Benchmark benchmark)
+{
+    GetBenchmarks().push_back(std::move(benchmark));
+    return true;
+}
+
+void DoNotOptimize(const void* value)
+{
+    sSink = value;
+}
+
+} // namespace MayaUsdBenchmark
@@ -0,0 +1,79 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef MAYAUSD_BENCHMARK_H
+#define MAYAUSD_BENCHMARK_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MayaUsdBenchmark {
+
+/// A measured piece of code, with the synthetic data it runs on.
+class Fixture
+{
+public:
+    virtual ~Fixture() = default;
+
+    /// Called before every iteration, outside of the measured time. Resets
+    /// the data that Run() modifies.
+    virtual void SetUp() {}
+
+    /// The measured code.
+    virtual void Run() = 0;
+};
+
+struct Benchmark
+{
+    std::string name;
+
+    /// Number of items (values, paths...) processed by one iteration.
+    size_t items;
+
+    /// Set when the fixture creates Maya objects, which needs Maya to be
+    /// initialized as a library first.
+    bool requiresMaya;
+
+    std::function<std::unique_ptr<Fixture>()> create;
+};
+
+/// Returns all registered benchmarks, in registration order.
+std::vector<Benchmark>& GetBenchmarks();
+
+/// Registers a benchmark, returns true so that it can initialize a static.
+bool RegisterBenchmark(Benchmark benchmark);
+
+/// Keeps the compiler from optimizing away the computation of a result that
+/// isn't otherwise used.
+void DoNotOptimize(const void* value);
+
+} // namespace MayaUsdBenchmark
+
+/// Registers FIXTURE under NAME. FIXTURE must be default constructible.
+#define MAYAUSD_BENCHMARK(FIXTURE, NAME, ITEMS)                                \
+    static const bool FIXTURE##_registered = MayaUsdBenchmark::RegisterBenchmark( \
+        { NAME, ITEMS, false, []() {                                          \
+            return std::unique_ptr<MayaUsdBenchmark::Fixture>(new FIXTURE()); } })
+
+/// Registers FIXTURE under NAME, for fixtures creating Maya objects.
+#define MAYAUSD_MAYA_BENCHMARK(FIXTURE, NAME, ITEMS)                           \
+    static const bool FIXTURE##_registered = MayaUsdBenchmark::RegisterBenchmark( \
+        { NAME, ITEMS, true, []() {                                           \
+            return std::unique_ptr<MayaUsdBenchmark::Fixture>(new FIXTURE()); } })
+
+#endif
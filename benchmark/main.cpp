@@ -0,0 +1,235 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "benchmark.h"
+
+#ifdef MAYAUSD_BENCHMARK_MLIBRARY
+#include <maya/MLibrary.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace MayaUsdBenchmark;
+
+namespace {
+
+struct Options
+{
+    std::string filter;
+    std::string outputFile;
+    double minTime = 0.5;
+    size_t minIterations = 5;
+    bool list = false;
+};
+
+struct Result
+{
+    const Benchmark* benchmark;
+    size_t iterations;
+    double minNs;
+    double medianNs;
+    double meanNs;
+    double maxNs;
+};
+
+void printUsage(const char* program)
+{
+    std::cerr
+        << "Usage: " << program << " [options]\n"
+        << "  --filter <text>        only run benchmarks whose name contains text\n"
+        << "  --out <file>           write the JSON results to file instead of stdout\n"
+        << "  --min-time <seconds>   minimum measured time per benchmark (default 0.5)\n"
+        << "  --min-iterations <n>   minimum iterations per benchmark (default 5)\n"
+        << "  --list                 list the benchmarks and exit\n";
+}
+
+bool parseOptions(int argc, char* argv[], Options& options)
+{
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(arg, "--filter") == 0 && hasValue) {
+            options.filter = argv[++i];
+        } else if (std::strcmp(arg, "--out") == 0 && hasValue) {
+            options.outputFile = argv[++i];
+        } else if (std::strcmp(arg, "--min-time") == 0 && hasValue) {
+            options.minTime = std::atof(argv[++i]);
+        } else if (std::strcmp(arg, "--min-iterations") == 0 && hasValue) {
+            options.minIterations = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(arg, "--list") == 0) {
+            options.list = true;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+Result runBenchmark(const Benchmark& benchmark, const Options& options)
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Don't run forever on functions that got very fast.
+    const size_t maxIterations = 1000000;
+
+    std::unique_ptr<Fixture> fixture = benchmark.create();
+
+    std::vector<double> samples;
+    double totalNs = 0.0;
+    while (samples.size() < maxIterations
+           && (samples.size() < options.minIterations || totalNs < options.minTime * 1e9)) {
+        fixture->SetUp();
+
+        const Clock::time_point start = Clock::now();
+        fixture->Run();
+        const Clock::time_point end = Clock::now();
+
+        const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+        samples.push_back(ns);
+        totalNs += ns;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    const size_t count = samples.size();
+    const double median = (count % 2) ? samples[count / 2]
+                                      : 0.5 * (samples[count / 2 - 1] + samples[count / 2]);
+
+    return { &benchmark, count, samples.front(), median, totalNs / count, samples.back() };
+}
+
+std::string jsonString(const std::string& value)
+{
+    std::string escaped("\"");
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    escaped += '"';
+    return escaped;
+}
+
+void writeJson(std::ostream& out, const std::vector<Result>& results, const Options& options)
+{
+    out << "{\n"
+        << "  \"context\": {\n"
+        << "    \"min_time_s\": " << options.minTime << ",\n"
+        << "    \"min_iterations\": " << options.minIterations << "\n"
+        << "  },\n"
+        << "  \"benchmarks\": [";
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& result = results[i];
+        const double itemsPerSecond = result.medianNs > 0.0
+            ? 1e9 * result.benchmark->items / result.medianNs : 0.0;
+
+        out << (i ? ",\n" : "\n")
+            << "    {\n"
+            << "      \"name\": " << jsonString(result.benchmark->name) << ",\n"
+            << "      \"iterations\": " << result.iterations << ",\n"
+            << "      \"items_per_iteration\": " << result.benchmark->items << ",\n"
+            << "      \"min_ns\": " << result.minNs << ",\n"
+            << "      \"median_ns\": " << result.medianNs << ",\n"
+            << "      \"mean_ns\": " << result.meanNs << ",\n"
+            << "      \"max_ns\": " << result.maxNs << ",\n"
+            << "      \"items_per_second\": " << itemsPerSecond << "\n"
+            << "    }";
+    }
+
+    out << "\n  ]\n}\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::vector<const Benchmark*> selected;
+    bool requiresMaya = false;
+    for (const Benchmark& benchmark : GetBenchmarks()) {
+        if (benchmark.name.find(options.filter) != std::string::npos) {
+            selected.push_back(&benchmark);
+            requiresMaya = requiresMaya || benchmark.requiresMaya;
+        }
+    }
+
+    if (options.list) {
+        for (const Benchmark* benchmark : selected) {
+            std::cout << benchmark->name << (benchmark->requiresMaya ? " (maya)" : "") << "\n";
+        }
+        return 0;
+    }
+
+    // Only initialize Maya when a fixture needs Maya objects, it's slow and
+    // takes a license.
+    bool mayaInitialized = false;
+    if (requiresMaya) {
+#ifdef MAYAUSD_BENCHMARK_MLIBRARY
+        mayaInitialized = MLibrary::initialize(argv[0], true) == MS::kSuccess;
+        if (!mayaInitialized) {
+            std::cerr << "Failed to initialize Maya, skipping the benchmarks that need it\n";
+        }
+#else
+        std::cerr << "Built without OpenMayalib, skipping the benchmarks that need Maya\n";
+#endif
+    }
+
+    std::vector<Result> results;
+    for (const Benchmark* benchmark : selected) {
+        if (benchmark->requiresMaya && !mayaInitialized) {
+            continue;
+        }
+
+        const Result result = runBenchmark(*benchmark, options);
+        results.push_back(result);
+
+        std::fprintf(stderr, "%-50s %10zu iterations %14.0f ns median\n",
+            benchmark->name.c_str(), result.iterations, result.medianNs);
+    }
+
+    int status = 0;
+    if (options.outputFile.empty()) {
+        writeJson(std::cout, results, options);
+    } else {
+        std::ofstream out(options.outputFile);
+        writeJson(out, results, options);
+        if (!out) {
+            std::cerr << "Failed to write " << options.outputFile << "\n";
+            status = 1;
+        }
+    }
+
+#ifdef MAYAUSD_BENCHMARK_MLIBRARY
+    if (mayaInitialized) {
+        MLibrary::cleanup(status, false);
+    }
+#endif
+
+    return status;
+}
@@ -226,6 +226,18 @@ foreach(MAYA_LIB
     endif()
 endforeach()
 
+# Maya's standalone library, only needed by executables that initialize Maya
+# themselves through MLibrary, e.g. the micro benchmarks. Plug-ins must not
+# link it, so it isn't part of MAYA_LIBRARIES.
+find_library(MAYA_OpenMayalib_LIBRARY
+        OpenMayalib
+    HINTS
+        "${MAYA_LIBRARY_DIR}"
+    DOC
+        "Maya's OpenMayalib library path"
+    NO_CMAKE_SYSTEM_PATH
+)
+
 find_program(MAYA_EXECUTABLE
         maya
     HINTS
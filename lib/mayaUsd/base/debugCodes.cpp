@@ -27,6 +27,8 @@ TF_REGISTRY_FUNCTION(TfDebug)
             "Debugging of the the diagnostics batching system in UsdMaya.");
     TF_DEBUG_ENVIRONMENT_SYMBOL(PXRUSDMAYA_TRANSLATORS,
             "Debugging of translators.");
+    TF_DEBUG_ENVIRONMENT_SYMBOL(PXRUSDMAYA_REFERENCE_ASSEMBLY,
+            "Debugging of the reference assembly activation.");
     TF_DEBUG_ENVIRONMENT_SYMBOL(USDMAYA_PROXYSHAPEBASE,
             "Base proxy shape evaluation");
     TF_DEBUG_ENVIRONMENT_SYMBOL(USDMAYA_PROXYACCESSOR,
@@ -25,6 +25,7 @@ TF_DEBUG_CODES(
     PXRUSDMAYA_REGISTRY,
     PXRUSDMAYA_DIAGNOSTICS,
     PXRUSDMAYA_TRANSLATORS,
+    PXRUSDMAYA_REFERENCE_ASSEMBLY,
     USDMAYA_PROXYSHAPEBASE,
     USDMAYA_PROXYACCESSOR
 );
@@ -123,6 +123,9 @@ MSyntax MayaUSDExportCommand::createSyntax()
     syntax.addFlag(kCompatibilityFlag,
                    UsdMayaJobExportArgsTokens->compatibility.GetText(),
                    MSyntax::kString);
+    syntax.addFlag(kFrameEvaluationFlag,
+                   UsdMayaJobExportArgsTokens->frameEvaluation.GetText(),
+                   MSyntax::kString);
 
     syntax.addFlag(kChaserFlag,
                    UsdMayaJobExportArgsTokens->chaser.GetText(),
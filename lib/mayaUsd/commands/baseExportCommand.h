@@ -76,6 +76,7 @@ class MAYAUSD_CORE_PUBLIC MayaUSDExportCommand : public MPxCommand
     static constexpr auto kMelPostCallbackFlag = "mpc";
     static constexpr auto kPythonPerFrameCallbackFlag = "pfc";
     static constexpr auto kPythonPostCallbackFlag = "ppc";
+    static constexpr auto kFrameEvaluationFlag = "fev";
     static constexpr auto kVerboseFlag = "v";
 
     // Short and Long forms of flags defined by this command itself:
@@ -31,6 +31,26 @@ UsdMayaChaser::ExportFrame(const UsdTimeCode& time)
     return true;
 }
 
+bool
+UsdMayaChaser::IsConcurrent() const
+{
+    return false;
+}
+
+bool
+UsdMayaChaser::ComputeFrame(const UsdTimeCode& time)
+{
+    // Do nothing by default.
+    return true;
+}
+
+bool
+UsdMayaChaser::AuthorFrame(const UsdTimeCode& time)
+{
+    // Do nothing by default.
+    return true;
+}
+
 bool
 UsdMayaChaser::PostExport()
 {
@@ -42,6 +42,15 @@ TF_DECLARE_REF_PTRS(UsdMayaChaser);
 /// Chasers need to be very careful as to not modify the structure of the usd
 /// file.  This should ideally be used to make small changes or to add
 /// attributes in a non-destructive way.
+///
+/// A chaser doing expensive computations per frame can return true from
+/// IsConcurrent().  Its ExportFrame() then only gathers the Maya data it needs
+/// for the frame, ComputeFrame() does the computation on a worker thread, and
+/// AuthorFrame() authors the result.  ComputeFrame() runs concurrently with
+/// the other concurrent chasers and with the evaluation and export of the
+/// next frame, so it must not use the Maya API nor the stage.  AuthorFrame()
+/// is called from the main thread, in chaser order, which keeps the exported
+/// layers deterministic.
 class UsdMayaChaser : public TfRefBase
 {
 public:
@@ -62,6 +71,25 @@ public:
     MAYAUSD_CORE_PUBLIC
     virtual bool ExportFrame(const UsdTimeCode& time);
 
+    /// Returns true if ComputeFrame() and AuthorFrame() are to be called for
+    /// every frame, see above.  Returns false by default.
+    MAYAUSD_CORE_PUBLIC
+    virtual bool IsConcurrent() const;
+
+    /// Do the computations for \p time, after ExportFrame().
+    /// Called from a worker thread, and must neither use the Maya API nor
+    /// read or author the stage.
+    /// Returning false will terminate the whole export.
+    MAYAUSD_CORE_PUBLIC
+    virtual bool ComputeFrame(const UsdTimeCode& time);
+
+    /// Author the results of ComputeFrame() for \p time.
+    /// Called from the main thread, at the latest before the next frame's
+    /// ExportFrame() or PostExport().
+    /// Returning false will terminate the whole export.
+    MAYAUSD_CORE_PUBLIC
+    virtual bool AuthorFrame(const UsdTimeCode& time);
+
     /// Do custom post-processing that needs to run after the main UsdMaya
     /// export loop.
     /// At this point, all data has been authored to the stage (except for
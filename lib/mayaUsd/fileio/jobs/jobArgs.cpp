@@ -351,6 +351,13 @@ UsdMayaJobExportArgs::UsdMayaJobExportArgs(
                 })),
         exportVisibility(
             _Boolean(userArgs, UsdMayaJobExportArgsTokens->exportVisibility)),
+        frameEvaluation(
+            _Token(userArgs,
+                UsdMayaJobExportArgsTokens->frameEvaluation,
+                UsdMayaJobExportArgsTokens->viewFrame,
+                {
+                    UsdMayaJobExportArgsTokens->dgContext
+                })),
         materialCollectionsPath(
             _AbsolutePath(userArgs,
                 UsdMayaJobExportArgsTokens->materialCollectionsPath)),
@@ -433,6 +440,7 @@ operator <<(std::ostream& out, const UsdMayaJobExportArgs& exportArgs)
         << "exportSkels: " << TfStringify(exportArgs.exportSkels) << std::endl
         << "exportSkin: " << TfStringify(exportArgs.exportSkin) << std::endl
         << "exportVisibility: " << TfStringify(exportArgs.exportVisibility) << std::endl
+        << "frameEvaluation: " << exportArgs.frameEvaluation << std::endl
         << "materialCollectionsPath: " << exportArgs.materialCollectionsPath << std::endl
         << "materialsScopeName: " << exportArgs.materialsScopeName << std::endl
         << "mergeTransformAndShape: " << TfStringify(exportArgs.mergeTransformAndShape) << std::endl
@@ -525,6 +533,8 @@ UsdMayaJobExportArgs::GetDefaultDictionary()
                 UsdMayaJobExportArgsTokens->none.GetString();
         d[UsdMayaJobExportArgsTokens->exportUVs] = true;
         d[UsdMayaJobExportArgsTokens->exportVisibility] = true;
+        d[UsdMayaJobExportArgsTokens->frameEvaluation] =
+                UsdMayaJobExportArgsTokens->viewFrame.GetString();
         d[UsdMayaJobExportArgsTokens->kind] = std::string();
         d[UsdMayaJobExportArgsTokens->materialCollectionsPath] = std::string();
         d[UsdMayaJobExportArgsTokens->materialsScopeName] =
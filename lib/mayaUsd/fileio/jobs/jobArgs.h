@@ -67,6 +67,7 @@ TF_DECLARE_PUBLIC_TOKENS(
     (exportSkin) \
     (exportUVs) \
     (exportVisibility) \
+    (frameEvaluation) \
     (kind) \
     (materialCollectionsPath) \
     (materialsScopeName) \
@@ -90,6 +91,9 @@ TF_DECLARE_PUBLIC_TOKENS(
     (defaultLayer) \
     (currentLayer) \
     (modelingVariant) \
+    /* frameEvaluation values */ \
+    (viewFrame) \
+    (dgContext) \
     /* exportSkels/exportSkin values */ \
     ((auto_, "auto")) \
     ((explicit_, "explicit")) \
@@ -153,6 +157,14 @@ struct UsdMayaJobExportArgs
     const TfToken exportSkin;
     const bool exportVisibility;
 
+    /// How the scene is evaluated at each time sample. With viewFrame, the
+    /// current time is changed to the sample, which also updates the
+    /// viewport and UI. With dgContext, the exported data is evaluated in a
+    /// DG context at the sample time and the current time doesn't change,
+    /// unless there are per-frame callbacks: they are run with the current
+    /// time set to the sample in both modes.
+    const TfToken frameEvaluation;
+
     /// If this is not empty, then a set of collections are exported on the
     /// prim pointed to by the path, each representing the collection of
     /// geometry that's bound to the various shading group sets in Maya.
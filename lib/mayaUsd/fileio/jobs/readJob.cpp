@@ -51,6 +51,7 @@
 #include <mayaUsd/fileio/translators/translatorMaterial.h>
 #include <mayaUsd/fileio/translators/translatorXformable.h>
 #include <mayaUsd/nodes/stageNode.h>
+#include <mayaUsd/utils/diagnosticDelegate.h>
 #include <mayaUsd/utils/stageCache.h>
 #include <mayaUsd/utils/util.h>
 
@@ -75,6 +76,10 @@ UsdMaya_ReadJob::~UsdMaya_ReadJob()
 bool
 UsdMaya_ReadJob::Read(std::vector<MDagPath>* addedDagPaths)
 {
+    // Collect the statuses and warnings of the import and display them once
+    // it's done, broken assets can issue a lot of them.
+    UsdMayaDiagnosticBatchContext diagBatchCtx;
+
     MStatus status;
 
     if (!TF_VERIFY(!mImportData.empty())) {
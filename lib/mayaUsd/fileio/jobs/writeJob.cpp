@@ -15,18 +15,22 @@
 //
 #include "writeJob.h"
 
+#include <algorithm>
 #include <limits>
 #include <map>
 #include <unordered_set>
 
 #include <maya/MAnimControl.h>
 #include <maya/MComputation.h>
+#include <maya/MDGContext.h>
+#include <maya/MDGContextGuard.h>
 #include <maya/MDistance.h>
 #include <maya/MFnDagNode.h>
 #include <maya/MFnRenderLayer.h>
 #include <maya/MGlobal.h>
 #include <maya/MItDag.h>
 #include <maya/MObjectArray.h>
+#include <maya/MObjectHandle.h>
 #include <maya/MPxNode.h>
 #include <maya/MStatus.h>
 #include <maya/MUuid.h>
@@ -34,7 +38,6 @@
 #include <pxr/pxr.h>
 #include <pxr/base/tf/fileUtils.h>
 #include <pxr/base/tf/hash.h>
-#include <pxr/base/tf/hashset.h>
 #include <pxr/base/tf/pathUtils.h>
 #include <pxr/base/tf/stl.h>
 #include <pxr/base/tf/stringUtils.h>
@@ -52,7 +55,10 @@
 #include <pxr/usd/usd/editContext.h>
 #include <pxr/usd/usd/primRange.h>
 #include <pxr/usd/usd/usdcFileFormat.h>
+#include <pxr/usd/usdGeom/bboxCache.h>
 #include <pxr/usd/usdGeom/metrics.h>
+#include <pxr/usd/usdGeom/modelAPI.h>
+#include <pxr/usd/usdGeom/tokens.h>
 #include <pxr/usd/usdGeom/xform.h>
 #include <pxr/usd/usdUtils/pipeline.h>
 #include <pxr/usd/usdUtils/dependencies.h>
@@ -66,6 +72,7 @@
 #include <mayaUsd/fileio/shading/shadingModeExporterContext.h>
 #include <mayaUsd/fileio/transformWriter.h>
 #include <mayaUsd/fileio/translators/translatorMaterial.h>
+#include <mayaUsd/utils/diagnosticDelegate.h>
 #include <mayaUsd/utils/util.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -110,9 +117,138 @@ _GetFallbackExtension(const TfToken& compatibilityMode)
     return UsdMayaTranslatorTokens->UsdFileExtensionDefault;
 }
 
+/// Finds two export DAG paths that are ancestors or descendants of each
+/// other, in O(n log n).
+/// Sorting full path names with the path separator ordered first makes the
+/// descendants of a path follow it directly, so only neighbours need to be
+/// compared.
+static
+bool
+_FindOverlappingDagPaths(
+        const UsdMayaUtil::MDagPathSet& dagPaths,
+        MDagPath* ancestorPath,
+        MDagPath* descendentPath)
+{
+    std::vector<std::pair<std::string, MDagPath>> sortedPaths;
+    sortedPaths.reserve(dagPaths.size());
+    for (const MDagPath& dagPath : dagPaths) {
+        std::string key(dagPath.fullPathName().asChar());
+        std::replace(key.begin(), key.end(), '|', '\x01');
+        sortedPaths.emplace_back(std::move(key), dagPath);
+    }
+    std::sort(sortedPaths.begin(), sortedPaths.end(),
+        [](const std::pair<std::string, MDagPath>& lhs,
+           const std::pair<std::string, MDagPath>& rhs) {
+            return lhs.first < rhs.first;
+        });
+
+    for (size_t i = 1; i < sortedPaths.size(); ++i) {
+        const MDagPath& path1 = sortedPaths[i - 1].second;
+        const MDagPath& path2 = sortedPaths[i].second;
+        if (UsdMayaUtil::isAncestorDescendentRelationship(path1, path2)) {
+            *ancestorPath = path1;
+            *descendentPath = path2;
+            return true;
+        }
+    }
+    return false;
+}
+
+namespace {
+
+/// Node of the tree made of the export DAG paths and their ancestors.
+struct _ExportTreeNode
+{
+    MDagPath path;
+    bool isArgDagPath = false;
+    std::vector<size_t> children;
+    UsdMayaUtil::MObjectHandleUnorderedMap<size_t> childIndices;
+};
+
+} // anonymous namespace
+
+/// Builds the tree of the export DAG paths and all of their ancestors, up to
+/// the world root which is the first node. Nodes are keyed on the handle of
+/// their Maya node under their parent, so instanced ancestors are kept apart.
+/// Children are in Maya's order, so that prims are written in the same order
+/// as a depth-first traversal of the whole DAG would.
+static
+std::vector<_ExportTreeNode>
+_BuildExportTree(const UsdMayaUtil::MDagPathSet& dagPaths)
+{
+    std::vector<_ExportTreeNode> tree(1);
+    MDagPath::getAPathTo(MItDag().root(), tree.front().path);
+
+    std::vector<MDagPath> ancestors;
+    for (const MDagPath& argDagPath : dagPaths) {
+        MStatus status;
+        const bool argDagPathIsValid = argDagPath.isValid(&status);
+        if (status != MS::kSuccess || !argDagPathIsValid) {
+            continue;
+        }
+
+        ancestors.clear();
+        MDagPath curDagPath(argDagPath);
+        while (curDagPath.length() > 0u) {
+            ancestors.push_back(curDagPath);
+            if (curDagPath.pop() != MS::kSuccess) {
+                break;
+            }
+        }
+
+        size_t current = 0u;
+        for (auto it = ancestors.rbegin(); it != ancestors.rend(); ++it) {
+            const MObjectHandle handle(it->node());
+            const auto found = tree[current].childIndices.find(handle);
+            if (found != tree[current].childIndices.end()) {
+                current = found->second;
+                continue;
+            }
+
+            const size_t index = tree.size();
+            tree[current].childIndices.emplace(handle, index);
+            tree[current].children.push_back(index);
+            tree.emplace_back();
+            tree.back().path = *it;
+            current = index;
+        }
+        tree[current].isArgDagPath = true;
+    }
+
+    for (size_t i = 0u; i < tree.size(); ++i) {
+        _ExportTreeNode& node = tree[i];
+        if (node.children.size() < 2u) {
+            continue;
+        }
+
+        const MFnDagNode parentFn(node.path);
+        const unsigned int childCount = parentFn.childCount();
+        std::vector<size_t> orderedChildren;
+        orderedChildren.reserve(node.children.size());
+        for (unsigned int c = 0u;
+                c < childCount && orderedChildren.size() < node.children.size();
+                ++c) {
+            const auto found =
+                node.childIndices.find(MObjectHandle(parentFn.child(c)));
+            if (found != node.childIndices.end()) {
+                orderedChildren.push_back(found->second);
+            }
+        }
+        if (orderedChildren.size() == node.children.size()) {
+            node.children.swap(orderedChildren);
+        }
+    }
+
+    return tree;
+}
+
 bool
 UsdMaya_WriteJob::Write(const std::string& fileName, bool append)
 {
+    // Collect the statuses and warnings of the export and display them once
+    // it's done.
+    UsdMayaDiagnosticBatchContext diagBatchCtx;
+
     const std::vector<double>& timeSamples = mJobCtx.mArgs.timeSamples;
 
     MComputation computation;
@@ -136,22 +272,53 @@ UsdMaya_WriteJob::Write(const std::string& fileName, bool append)
     if (!timeSamples.empty()) {
         const MTime oldCurTime = MAnimControl::currentTime();
 
+        // Evaluating in a DG context doesn't change the current time, so
+        // each sample doesn't pay for the viewport and UI updates and for
+        // the evaluation of nodes that aren't exported.
+        const bool useDGContext = (mJobCtx.mArgs.frameEvaluation ==
+            UsdMayaJobExportArgsTokens->dgContext);
+
+        // User per-frame callbacks may query the current time, so it is set
+        // to the sample before they run in both modes. In the dgContext mode,
+        // this only costs a time change per sample when there are callbacks.
+        const bool hasPerFrameCallbacks =
+            !mJobCtx.mArgs.melPerFrameCallback.empty() ||
+            !mJobCtx.mArgs.pythonPerFrameCallback.empty();
+        const bool changesCurrentTime = !useDGContext || hasPerFrameCallbacks;
+
         int progress = 0;
         for (double t : timeSamples) {
             if (mJobCtx.mArgs.verbose) {
                 TF_STATUS("%f", t);
             }
-            MGlobal::viewFrame(t);
+            if (!useDGContext) {
+                MGlobal::viewFrame(t);
+            }
             computation.setProgress(progress);
             progress++;
 
             // Process per frame data.
-            if (!_WriteFrame(t)) {
-                MGlobal::viewFrame(oldCurTime);
+            bool frameWritten = false;
+            if (useDGContext) {
+                MDGContextGuard contextGuard(MTime(t, MTime::uiUnit()));
+                frameWritten = _WriteFrame(t);
+            }
+            else {
+                frameWritten = _WriteFrame(t);
+            }
+            if (!frameWritten) {
+                if (changesCurrentTime) {
+                    MGlobal::viewFrame(oldCurTime);
+                }
                 computation.endComputation();
                 return false;
             }
 
+            if (useDGContext && hasPerFrameCallbacks) {
+                MGlobal::viewFrame(t);
+            }
+            _PerFrameCallback(t);
+
             // Allow user cancellation.
             if (computation.isInterruptRequested()) {
                 break;
@@ -159,7 +326,15 @@ UsdMaya_WriteJob::Write(const std::string& fileName, bool append)
         }
 
         // Set the time back.
-        MGlobal::viewFrame(oldCurTime);
+        if (changesCurrentTime) {
+            MGlobal::viewFrame(oldCurTime);
+        }
+    }
+
+    // Let the concurrent chasers author the last frame.
+    if (!_FinishChaserFrame()) {
+        computation.endComputation();
+        return false;
     }
 
     // Finalize the export, close the stage.
@@ -177,23 +352,17 @@ UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
 {
     // Check for DAG nodes that are a child of an already specified DAG node to export
     // if that's the case, report the issue and skip the export
-    UsdMayaUtil::MDagPathSet::const_iterator m, n;
-    UsdMayaUtil::MDagPathSet::const_iterator endPath = mJobCtx.mArgs.dagPaths.end();
-    for (m = mJobCtx.mArgs.dagPaths.begin(); m != endPath; ) {
-        MDagPath path1 = *m; m++;
-        for (n = m; n != endPath; n++) {
-            MDagPath path2 = *n;
-            if (UsdMayaUtil::isAncestorDescendentRelationship(path1,path2)) {
-                TF_RUNTIME_ERROR(
-                        "%s and %s are ancestors or descendants of each other. "
-                        "Please specify export DAG paths that don't overlap. "
-                        "Exiting.",
-                        path1.fullPathName().asChar(),
-                        path2.fullPathName().asChar());
-                return false;
-            }
-        }  // for n
-    }  // for m
+    MDagPath ancestorPath, descendentPath;
+    if (_FindOverlappingDagPaths(
+            mJobCtx.mArgs.dagPaths, &ancestorPath, &descendentPath)) {
+        TF_RUNTIME_ERROR(
+                "%s and %s are ancestors or descendants of each other. "
+                "Please specify export DAG paths that don't overlap. "
+                "Exiting.",
+                ancestorPath.fullPathName().asChar(),
+                descendentPath.fullPathName().asChar());
+        return false;
+    }
 
     // Make sure the file name is a valid one with a proper USD extension.
     TfToken fileExt(TfGetExtension(fileName));
@@ -293,111 +462,84 @@ UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
                                         defaultLayer.name(), false, false);
     }
 
-    // Pre-process the argument dagPath path names into two sets. One set
-    // contains just the arg dagPaths, and the other contains all parents of
-    // arg dagPaths all the way up to the world root. Partial path names are
-    // enough because Maya guarantees them to still be unique, and they require
-    // less work to hash and compare than full path names.
-    TfHashSet<std::string, TfHash> argDagPaths;
-    TfHashSet<std::string, TfHash> argDagPathParents;
-    UsdMayaUtil::MDagPathSet::const_iterator end = mJobCtx.mArgs.dagPaths.end();
-    for (UsdMayaUtil::MDagPathSet::const_iterator it = mJobCtx.mArgs.dagPaths.begin();
-            it != end; ++it) {
-        MDagPath curDagPath = *it;
-        MStatus status;
-        bool curDagPathIsValid = curDagPath.isValid(&status);
-        if (status != MS::kSuccess || !curDagPathIsValid) {
-            continue;
-        }
-
-        std::string curDagPathStr(curDagPath.partialPathName(&status).asChar());
-        if (status != MS::kSuccess) {
-            continue;
+    // Only the export DAG paths, their descendants and their ancestors are
+    // exported, so traverse the DAG from the export DAG paths rather than
+    // from the world root. Ancestors are written on their own, and the
+    // subtree of each export DAG path is traversed with an MItDag.
+    enum class _WriteResult { Continue, Prune, Error };
+    auto writeDagPath = [this](const MDagPath& curDagPath) {
+        if (!mJobCtx._NeedToTraverse(curDagPath) &&
+            curDagPath.length() > 0) {
+            // This dagPath and all of its children should be pruned.
+            return _WriteResult::Prune;
         }
 
-        argDagPaths.insert(curDagPathStr);
-
-        status = curDagPath.pop();
-        if (status != MS::kSuccess) {
-            continue;
+        const MFnDagNode dagNodeFn(curDagPath);
+        UsdMayaPrimWriterSharedPtr primWriter = mJobCtx.CreatePrimWriter(dagNodeFn);
+        if (!primWriter) {
+            return _WriteResult::Continue;
         }
-        curDagPathIsValid = curDagPath.isValid(&status);
 
-        while (status == MS::kSuccess && curDagPathIsValid) {
-            curDagPathStr = curDagPath.partialPathName(&status).asChar();
-            if (status != MS::kSuccess) {
-                break;
-            }
+        mJobCtx.mMayaPrimWriterList.push_back(primWriter);
 
-            if (argDagPathParents.find(curDagPathStr) != argDagPathParents.end()) {
-                // We've already traversed up from this path.
-                break;
+        // Write out data (non-animated/default values).
+        if (const auto& usdPrim = primWriter->GetUsdPrim()) {
+            if (!_CheckNameClashes(
+                    usdPrim.GetPath(), primWriter->GetDagPath()))
+            {
+                return _WriteResult::Error;
             }
-            argDagPathParents.insert(curDagPathStr);
 
-            status = curDagPath.pop();
-            if (status != MS::kSuccess) {
-                break;
-            }
-            curDagPathIsValid = curDagPath.isValid(&status);
-        }
-    }
+            primWriter->Write(UsdTimeCode::Default());
 
-    // Now do a depth-first traversal of the Maya DAG from the world root.
-    // We keep a reference to arg dagPaths as we encounter them.
-    MDagPath curLeafDagPath;
-    for (MItDag itDag(MItDag::kDepthFirst, MFn::kInvalid); !itDag.isDone(); itDag.next()) {
-        MDagPath curDagPath;
-        itDag.getPath(curDagPath);
-        std::string curDagPathStr(curDagPath.partialPathName().asChar());
+            const UsdMayaUtil::MDagPathMap<SdfPath>& mapping =
+                    primWriter->GetDagToUsdPathMapping();
+            mDagPathToUsdPathMap.insert(mapping.begin(), mapping.end());
 
-        if (argDagPathParents.find(curDagPathStr) != argDagPathParents.end()) {
-            // This dagPath is a parent of one of the arg dagPaths. It should
-            // be included in the export, but not necessarily all of its
-            // children should be, so we continue to traverse down.
-        } else if (argDagPaths.find(curDagPathStr) != argDagPaths.end()) {
-            // This dagPath IS one of the arg dagPaths. It AND all of its
-            // children should be included in the export.
-            curLeafDagPath = curDagPath;
-        } else if (!MFnDagNode(curDagPath).hasParent(curLeafDagPath.node())) {
-            // This dagPath is not a child of one of the arg dagPaths, so prune
-            // it and everything below it from the traversal.
-            itDag.prune();
-            continue;
+            _modelKindProcessor->OnWritePrim(usdPrim, primWriter);
         }
 
-        if (!mJobCtx._NeedToTraverse(curDagPath) &&
-            curDagPath.length() > 0) {
-            // This dagPath and all of its children should be pruned.
-            itDag.prune();
-        } else {
-            const MFnDagNode dagNodeFn(curDagPath);
-            UsdMayaPrimWriterSharedPtr primWriter = mJobCtx.CreatePrimWriter(dagNodeFn);
-
-            if (primWriter) {
-                mJobCtx.mMayaPrimWriterList.push_back(primWriter);
-
-                // Write out data (non-animated/default values).
-                if (const auto& usdPrim = primWriter->GetUsdPrim()) {
-                    if (!_CheckNameClashes(
-                            usdPrim.GetPath(), primWriter->GetDagPath()))
-                    {
-                        return false;
-                    }
-
-                    primWriter->Write(UsdTimeCode::Default());
+        return primWriter->ShouldPruneChildren() ?
+            _WriteResult::Prune : _WriteResult::Continue;
+    };
 
-                    const UsdMayaUtil::MDagPathMap<SdfPath>& mapping =
-                            primWriter->GetDagToUsdPathMapping();
-                    mDagPathToUsdPathMap.insert(mapping.begin(), mapping.end());
+    const std::vector<_ExportTreeNode> exportTree =
+        _BuildExportTree(mJobCtx.mArgs.dagPaths);
+    std::vector<size_t> nodeStack(1u, 0u);
+    while (!nodeStack.empty()) {
+        const _ExportTreeNode& node = exportTree[nodeStack.back()];
+        nodeStack.pop_back();
 
-                    _modelKindProcessor->OnWritePrim(usdPrim, primWriter);
+        if (node.isArgDagPath) {
+            // This dagPath IS one of the arg dagPaths. It AND all of its
+            // children should be included in the export.
+            MItDag itDag;
+            itDag.reset(node.path, MItDag::kDepthFirst, MFn::kInvalid);
+            for (; !itDag.isDone(); itDag.next()) {
+                MDagPath curDagPath;
+                itDag.getPath(curDagPath);
+
+                const _WriteResult result = writeDagPath(curDagPath);
+                if (result == _WriteResult::Error) {
+                    return false;
                 }
-
-                if (primWriter->ShouldPruneChildren()) {
+                if (result == _WriteResult::Prune) {
                     itDag.prune();
                 }
             }
+            continue;
+        }
+
+        // This dagPath is a parent of one of the arg dagPaths. It should
+        // be included in the export, but not necessarily all of its
+        // children should be.
+        const _WriteResult result = writeDagPath(node.path);
+        if (result == _WriteResult::Error) {
+            return false;
+        }
+        if (result == _WriteResult::Continue) {
+            nodeStack.insert(
+                nodeStack.end(), node.children.rbegin(), node.children.rend());
         }
     }
 
@@ -417,6 +559,18 @@ UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
         return false;
     }
 
+    // Readers bounding the stage can stop at the model roots if they carry an
+    // extentsHint, instead of visiting every gprim below them.
+    mModelRootPaths.clear();
+    UsdPrimRange range = UsdPrimRange::AllPrims(mJobCtx.mStage->GetPseudoRoot());
+    for (auto it = range.begin(); it != range.end(); ++it) {
+        if (it->IsModel() && !it->IsPseudoRoot()) {
+            mModelRootPaths.push_back(it->GetPath());
+            it.PruneChildren();
+        }
+    }
+    _WriteExtentsHints(UsdTimeCode::Default());
+
     // now we populate the chasers and run export default
     mChasers.clear();
     UsdMayaChaserRegistry::FactoryContext ctx(mJobCtx.mStage, mDagPathToUsdPathMap, mJobCtx.mArgs);
@@ -452,13 +606,93 @@ UsdMaya_WriteJob::_WriteFrame(double iFrame)
         }
     }
 
+    _WriteExtentsHints(usdTime);
+
+    // The concurrent chasers computed the previous frame while this one was
+    // evaluated and written.
+    if (!_FinishChaserFrame()) {
+        return false;
+    }
+
     for (UsdMayaChaserRefPtr& chaser : mChasers) {
         if (!chaser->ExportFrame(iFrame)) {
             return false;
         }
     }
 
-    _PerFrameCallback(iFrame);
+    for (const UsdMayaChaserRefPtr& chaser : mChasers) {
+        if (chaser->IsConcurrent()) {
+            mChaserDispatcher.Run([this, chaser, usdTime]() {
+                if (!chaser->ComputeFrame(usdTime)) {
+                    mChaserComputeFailed = true;
+                }
+            });
+            mHasPendingChaserFrame = true;
+        }
+    }
+    mPendingChaserTime = usdTime;
+
+    return true;
+}
+
+void
+UsdMaya_WriteJob::_WriteExtentsHints(const UsdTimeCode& usdTime)
+{
+    if (mModelRootPaths.empty()) {
+        return;
+    }
+
+    if (!mExtentsHintBBoxCache) {
+        // Bound every purpose, the hint stores one range per purpose.
+        mExtentsHintBBoxCache.reset(new UsdGeomBBoxCache(
+            usdTime,
+            UsdGeomImageable::GetOrderedPurposeTokens(),
+            /* useExtentsHint = */ false));
+    }
+    else {
+        mExtentsHintBBoxCache->SetTime(usdTime);
+    }
+
+    for (const SdfPath& path : mModelRootPaths) {
+        const UsdPrim prim = mJobCtx.mStage->GetPrimAtPath(path);
+        if (!prim) {
+            continue;
+        }
+
+        // Same attribute as UsdGeomModelAPI::SetExtentsHint(), written
+        // sparsely so that static models only get a default value.
+        const UsdGeomModelAPI modelAPI(prim);
+        const UsdAttribute extentsHintAttr = prim.CreateAttribute(
+            UsdGeomTokens->extentsHint,
+            SdfValueTypeNames->Float3Array,
+            /* custom = */ false);
+        mExtentsHintValueWriter.SetAttribute(
+            extentsHintAttr,
+            VtValue(modelAPI.ComputeExtentsHint(*mExtentsHintBBoxCache)),
+            usdTime);
+    }
+}
+
+bool
+UsdMaya_WriteJob::_FinishChaserFrame()
+{
+    if (!mHasPendingChaserFrame) {
+        return true;
+    }
+
+    mChaserDispatcher.Wait();
+    mHasPendingChaserFrame = false;
+    if (mChaserComputeFailed) {
+        return false;
+    }
+
+    // Author in chaser order, regardless of which computation finished first.
+    for (const UsdMayaChaserRefPtr& chaser : mChasers) {
+        if (chaser->IsConcurrent() &&
+                !chaser->AuthorFrame(mPendingChaserTime)) {
+            return false;
+        }
+    }
 
     return true;
 }
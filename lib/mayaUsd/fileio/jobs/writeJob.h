@@ -16,12 +16,18 @@
 #ifndef PXRUSDMAYA_WRITE_JOB_H
 #define PXRUSDMAYA_WRITE_JOB_H
 
+#include <atomic>
+#include <memory>
 #include <string>
 
 #include <maya/MObjectHandle.h>
 
 #include <pxr/pxr.h>
 #include <pxr/base/tf/hashmap.h>
+#include <pxr/base/work/dispatcher.h>
+#include <pxr/usd/usd/timeCode.h>
+#include <pxr/usd/usdGeom/bboxCache.h>
+#include <pxr/usd/usdUtils/sparseValueWriter.h>
 
 #include <mayaUsd/base/api.h>
 #include <mayaUsd/fileio/chaser/chaser.h>
@@ -70,6 +76,14 @@ private:
     /// Creates a usdz package from the write job's current USD stage.
     void _CreatePackage() const;
 
+    /// Authors extentsHint on the model roots at the given time, from the
+    /// bounds of what was written at that time.
+    void _WriteExtentsHints(const UsdTimeCode& usdTime);
+
+    /// Waits for the concurrent chasers to compute the last written frame,
+    /// then lets them author it.
+    bool _FinishChaserFrame();
+
     void _PerFrameCallback(double iFrame);
     void _PostCallback();
 
@@ -97,6 +111,20 @@ private:
     UsdMayaWriteJobContext mJobCtx;
 
     std::unique_ptr<UsdMaya_ModelKindProcessor> _modelKindProcessor;
+
+    // Topmost model prims of the exported hierarchy, which get an extentsHint.
+    // The hints are written sparsely, and bounded with a single cache moved
+    // from frame to frame.
+    SdfPathVector mModelRootPaths;
+    std::unique_ptr<UsdGeomBBoxCache> mExtentsHintBBoxCache;
+    UsdUtilsSparseValueWriter mExtentsHintValueWriter;
+
+    // Concurrent chasers compute a frame while the next one is written.
+    // Declared last, so that pending computations are waited for first.
+    UsdTimeCode mPendingChaserTime;
+    bool mHasPendingChaserFrame = false;
+    std::atomic<bool> mChaserComputeFailed{false};
+    WorkDispatcher mChaserDispatcher;
 };
 
 
@@ -17,6 +17,8 @@
 //
 #include "meshReadUtils.h"
 
+#include <algorithm>
+
 #include <maya/MFloatVector.h>
 #include <maya/MFloatVectorArray.h>
 #include <maya/MFnBlendShapeDeformer.h>
@@ -26,7 +28,6 @@
 #include <maya/MGlobal.h>
 #include <maya/MIntArray.h>
 #include <maya/MItMeshEdge.h>
-#include <maya/MItMeshFaceVertex.h>
 #include <maya/MItMeshVertex.h>
 #include <maya/MPlug.h>
 #include <maya/MPointArray.h>
@@ -141,40 +142,61 @@ namespace
         return true;
     }
 
+    // Computes the value assignment of each face vertex of the mesh described by
+    // vertexCounts and vertexList, as returned by MFnMesh::getVertices(), in
+    // Maya's face vertex order. Any assignments left as -1 will not be assigned
+    // a value.
     MIntArray
-    getMayaFaceVertexAssignmentIds( const MFnMesh& meshFn,
+    getMayaFaceVertexAssignmentIds( const MIntArray& vertexCounts,
+                                    const MIntArray& vertexList,
                                     const TfToken& interpolation,
                                     const VtIntArray& assignmentIndices,
                                     const int unauthoredValuesIndex)
     {
-        MIntArray valueIds(meshFn.numFaceVertices(), -1);
-
-        MItMeshFaceVertex itFV(meshFn.object());
-        unsigned int fvi = 0;
-        for (itFV.reset(); !itFV.isDone(); itFV.next(), ++fvi) {
-            int valueId = 0;
-            if (interpolation == UsdGeomTokens->constant) {
-                valueId = 0;
-            } else if (interpolation == UsdGeomTokens->uniform) {
-                valueId = itFV.faceId();
-            } else if (interpolation == UsdGeomTokens->vertex) {
-                valueId = itFV.vertId();
-            } else if (interpolation == UsdGeomTokens->faceVarying) {
-                valueId = fvi;
-            }
+        const unsigned int numFaces = vertexCounts.length();
+        const unsigned int numFaceVertices = vertexList.length();
+        MIntArray valueIds(numFaceVertices, -1);
 
-            if (static_cast<size_t>(valueId) < assignmentIndices.size()) {
+        const size_t numAssignmentIndices = assignmentIndices.size();
+        const int* indices = assignmentIndices.cdata();
+
+        auto assign = [&](unsigned int fvi, int valueId) {
+            if (static_cast<size_t>(valueId) < numAssignmentIndices) {
                 // The data is indexed, so consult the indices array for the
                 // correct index into the data.
-                valueId = assignmentIndices[valueId];
+                valueId = indices[valueId];
 
                 if (valueId == unauthoredValuesIndex) {
                     // This component had no authored value, so leave it unassigned.
-                    continue;
+                    return;
                 }
             }
 
             valueIds[fvi] = valueId;
+        };
+
+        if (interpolation == UsdGeomTokens->uniform) {
+            unsigned int fvi = 0;
+            for (unsigned int face = 0; face < numFaces; ++face) {
+                const unsigned int faceEnd =
+                    std::min(fvi + static_cast<unsigned int>(vertexCounts[face]), numFaceVertices);
+                for (; fvi < faceEnd; ++fvi) {
+                    assign(fvi, face);
+                }
+            }
+        } else if (interpolation == UsdGeomTokens->vertex) {
+            for (unsigned int fvi = 0; fvi < numFaceVertices; ++fvi) {
+                assign(fvi, vertexList[fvi]);
+            }
+        } else if (interpolation == UsdGeomTokens->faceVarying) {
+            for (unsigned int fvi = 0; fvi < numFaceVertices; ++fvi) {
+                assign(fvi, fvi);
+            }
+        } else {
+            // constant, and anything we don't know about, uses the first value.
+            for (unsigned int fvi = 0; fvi < numFaceVertices; ++fvi) {
+                assign(fvi, 0);
+            }
         }
 
         return valueIds;
@@ -289,13 +311,6 @@ namespace
 
         const TfToken& interpolation = primvar.GetInterpolation();
 
-        // Build an array of value assignments for each face vertex in the mesh.
-        // Any assignments left as -1 will not be assigned a value.
-        MIntArray uvIds = getMayaFaceVertexAssignmentIds(meshFn,
-                                                          interpolation,
-                                                          assignmentIndices,
-                                                          -1);
-
         MIntArray vertexCounts;
         MIntArray vertexList;
         status = meshFn.getVertices(vertexCounts, vertexList);
@@ -306,6 +321,14 @@ namespace
             return false;
         }
 
+        // Build an array of value assignments for each face vertex in the mesh.
+        // Any assignments left as -1 will not be assigned a value.
+        MIntArray uvIds = getMayaFaceVertexAssignmentIds(vertexCounts,
+                                                          vertexList,
+                                                          interpolation,
+                                                          assignmentIndices,
+                                                          -1);
+
         status = meshFn.assignUVs(vertexCounts, uvIds, &uvSetName);
         if (status != MS::kSuccess) {
             TF_WARN("Could not assign UV values to UV set '%s' on mesh: %s",
@@ -494,9 +517,20 @@ namespace
 
         const TfToken& interpolation = primvar.GetInterpolation();
 
+        MIntArray vertexCounts;
+        MIntArray vertexList;
+        status = meshFn.getVertices(vertexCounts, vertexList);
+        if (status != MS::kSuccess) {
+            TF_WARN("Could not get vertex counts for color set '%s' on mesh: %s",
+                    colorSetName.asChar(),
+                    meshFn.fullPathName().asChar());
+            return false;
+        }
+
         // Build an array of value assignments for each face vertex in the mesh.
         // Any assignments left as -1 will not be assigned a value.
-        MIntArray colorIds = getMayaFaceVertexAssignmentIds(meshFn,
+        MIntArray colorIds = getMayaFaceVertexAssignmentIds(vertexCounts,
+                                                             vertexList,
                                                              interpolation,
                                                              assignmentIndices,
                                                              unauthoredValuesIndex);
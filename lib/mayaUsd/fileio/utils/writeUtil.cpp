@@ -15,6 +15,7 @@
 //
 #include "writeUtil.h"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -45,7 +46,6 @@
 
 #include <pxr/pxr.h>
 #include <pxr/base/gf/gamma.h>
-#include <pxr/base/gf/rotation.h>
 #include <pxr/base/tf/envSetting.h>
 #include <pxr/base/tf/token.h>
 #include <pxr/base/vt/types.h>
@@ -69,6 +69,8 @@
 #include <mayaUsd/utils/colorSpace.h>
 #include <mayaUsd/utils/converter.h>
 
+#include <mayaUsdUtils/ArrayConversion.h>
+
 using namespace MAYAUSD_NS;
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -928,17 +930,36 @@ UsdMayaWriteUtil::WriteClassInherits(
     return true;
 }
 
-template <typename MArrayType, typename M, typename V>
-static VtArray<V>
-_MapMayaToVtArray(
-    const MArrayType& mayaArray,
-    const std::function<V (const M)> mapper)
+// Maya's array classes store their elements contiguously, so the instancer
+// channels are converted in bulk through a pointer to their first element
+// rather than element by element.
+static_assert(sizeof(MVector) == 3 * sizeof(double),
+              "MVector is expected to be three tightly packed doubles");
+
+static
+const double*
+_GetArrayData(MDoubleArray& mayaArray)
 {
-    VtArray<V> vtArray(mayaArray.length());
-    for (unsigned int i = 0; i < mayaArray.length(); ++i) {
-        vtArray[i] = mapper(mayaArray[i]);
-    }
-    return vtArray;
+    return mayaArray.length() > 0u ? &mayaArray[0] : nullptr;
+}
+
+static
+const double*
+_GetArrayData(MVectorArray& mayaArray)
+{
+    return mayaArray.length() > 0u ? &mayaArray[0].x : nullptr;
+}
+
+static
+bool
+_IsWrittenInstancerChannel(const MString& channel)
+{
+    return channel == "id" ||
+        channel == "objectIndex" ||
+        channel == "position" ||
+        channel == "rotation" ||
+        channel == "scale" ||
+        channel == "visibility";
 }
 
 // static
@@ -952,14 +973,61 @@ UsdMayaWriteUtil::WriteArrayAttrsToInstancer(
 {
     MStatus status;
 
+    // Fetch each of the channels we write exactly once; every access through
+    // MFnArrayAttrsData hands back a new array.
+    MFnArrayAttrsData::Type type;
+    const bool hasId = inputPointsData.checkArrayExist("id", type) &&
+            type == MFnArrayAttrsData::kDoubleArray;
+    MDoubleArray id = hasId ?
+            inputPointsData.doubleArray("id", &status) : MDoubleArray();
+    CHECK_MSTATUS_AND_RETURN(status, false);
+
+    const bool hasObjectIndex =
+            inputPointsData.checkArrayExist("objectIndex", type) &&
+            type == MFnArrayAttrsData::kDoubleArray;
+    MDoubleArray objectIndex = hasObjectIndex ?
+            inputPointsData.doubleArray("objectIndex", &status) :
+            MDoubleArray();
+    CHECK_MSTATUS_AND_RETURN(status, false);
+
+    const bool hasPosition = inputPointsData.checkArrayExist("position", type) &&
+            type == MFnArrayAttrsData::kVectorArray;
+    MVectorArray position = hasPosition ?
+            inputPointsData.vectorArray("position", &status) : MVectorArray();
+    CHECK_MSTATUS_AND_RETURN(status, false);
+
+    const bool hasRotation = inputPointsData.checkArrayExist("rotation", type) &&
+            type == MFnArrayAttrsData::kVectorArray;
+    MVectorArray rotation = hasRotation ?
+            inputPointsData.vectorArray("rotation", &status) : MVectorArray();
+    CHECK_MSTATUS_AND_RETURN(status, false);
+
+    const bool hasScale = inputPointsData.checkArrayExist("scale", type) &&
+            type == MFnArrayAttrsData::kVectorArray;
+    MVectorArray scale = hasScale ?
+            inputPointsData.vectorArray("scale", &status) : MVectorArray();
+    CHECK_MSTATUS_AND_RETURN(status, false);
+
+    const bool hasVisibility =
+            inputPointsData.checkArrayExist("visibility", type) &&
+            type == MFnArrayAttrsData::kDoubleArray;
+    MDoubleArray visibility = hasVisibility ?
+            inputPointsData.doubleArray("visibility", &status) :
+            MDoubleArray();
+    CHECK_MSTATUS_AND_RETURN(status, false);
+
     // We need to figure out how many instances there are. Some arrays are
     // sparse (contain less values than there are instances), so just loop
     // through all the arrays and assume that there are as many instances as the
     // size of the largest array.
-    unsigned int numInstances = 0;
+    unsigned int numInstances = std::max({
+            id.length(), objectIndex.length(), position.length(),
+            rotation.length(), scale.length(), visibility.length()});
     const MStringArray channels = inputPointsData.list();
     for (unsigned int i = 0; i < channels.length(); ++i) {
-        MFnArrayAttrsData::Type type;
+        if (_IsWrittenInstancerChannel(channels[i])) {
+            continue;
+        }
         if (inputPointsData.checkArrayExist(channels[i], type)) {
             switch (type) {
                 case MFnArrayAttrsData::kVectorArray: {
@@ -990,47 +1058,31 @@ UsdMayaWriteUtil::WriteArrayAttrsToInstancer(
     // interprets some attributes (e.g. visibility) as referring to id's if
     // present or indices otherwise.
     VtInt64Array indicesOrIds;
-    MFnArrayAttrsData::Type type;
-    if (inputPointsData.checkArrayExist("id", type) &&
-            type == MFnArrayAttrsData::kDoubleArray) {
-        const MDoubleArray id = inputPointsData.doubleArray("id", &status);
-        CHECK_MSTATUS_AND_RETURN(status, false);
-
-        indicesOrIds = _MapMayaToVtArray<
-            MDoubleArray, double, int64_t>(
-            id,
-            [](double x) {
-                return (int64_t) x;
-            });
+    if (hasId) {
+        indicesOrIds.resize(id.length());
+        MayaUsdUtils::convertDoubleToInt64(
+            indicesOrIds.data(), _GetArrayData(id), id.length());
         SetAttribute(instancer.CreateIdsAttr(), indicesOrIds, usdTime, valueWriter);
     }
     else {
         // Skip writing the id's, but still generate the indicesOrIds array.
+        indicesOrIds.resize(numInstances);
         for (size_t i = 0; i < numInstances; ++i) {
-            indicesOrIds.push_back(i);
+            indicesOrIds[i] = i;
         }
     }
 
     // Export the rest of the per-instance array attrs.
     // Some attributes might be missing elements; pad the array according to
     // Maya's fallback behavior up to the numInstances.
-    if (inputPointsData.checkArrayExist("objectIndex", type) &&
-            type == MFnArrayAttrsData::kDoubleArray) {
-        const MDoubleArray objectIndex = inputPointsData.doubleArray(
-                "objectIndex", &status);
-        CHECK_MSTATUS_AND_RETURN(status, false);
-
-        VtIntArray vtArray = _MapMayaToVtArray<MDoubleArray, double, int>(
-            objectIndex,
-            [numPrototypes](double x) {
-                if (x < numPrototypes) {
-                    return (int) x;
-                }
-                else {
-                    // Return the *last* prototype if out of bounds.
-                    return (int) numPrototypes - 1;
-                }
-            });
+    if (hasObjectIndex) {
+        VtIntArray vtArray(objectIndex.length());
+        const double* const data = _GetArrayData(objectIndex);
+        for (size_t i = 0; i < vtArray.size(); ++i) {
+            // Use the *last* prototype if out of bounds.
+            vtArray[i] = data[i] < numPrototypes ?
+                (int) data[i] : (int) numPrototypes - 1;
+        }
         SetAttribute(instancer.CreateProtoIndicesAttr(), vtArray, usdTime, valueWriter);
     }
     else {
@@ -1040,18 +1092,12 @@ UsdMayaWriteUtil::WriteArrayAttrsToInstancer(
                       vtArray, usdTime, valueWriter);
     }
 
-    if (inputPointsData.checkArrayExist("position", type) &&
-            type == MFnArrayAttrsData::kVectorArray) {
-        const MVectorArray position = inputPointsData.vectorArray("position",
-                &status);
-        CHECK_MSTATUS_AND_RETURN(status, false);
-
-        VtVec3fArray vtArray = _MapMayaToVtArray<
-            MVectorArray, const MVector&, GfVec3f>(
-            position,
-            [](const MVector& v) {
-                return GfVec3f(v.x, v.y, v.z);
-            });
+    if (hasPosition) {
+        VtVec3fArray vtArray(position.length());
+        MayaUsdUtils::convertDoubleToFloat(
+            reinterpret_cast<float*>(vtArray.data()),
+            _GetArrayData(position),
+            3 * vtArray.size());
         SetAttribute(instancer.CreatePositionsAttr(), vtArray, usdTime, valueWriter);
     }
     else {
@@ -1060,21 +1106,10 @@ UsdMayaWriteUtil::WriteArrayAttrsToInstancer(
         SetAttribute(instancer.CreatePositionsAttr(), vtArray, usdTime, valueWriter);
     }
 
-    if (inputPointsData.checkArrayExist("rotation", type) &&
-            type == MFnArrayAttrsData::kVectorArray) {
-        const MVectorArray rotation = inputPointsData.vectorArray("rotation",
-                &status);
-        CHECK_MSTATUS_AND_RETURN(status, false);
-
-        VtQuathArray vtArray = _MapMayaToVtArray<
-            MVectorArray, const MVector&, GfQuath>(
-            rotation,
-            [](const MVector& v) {
-                GfRotation rot = GfRotation(GfVec3d::XAxis(), v.x)
-                        * GfRotation(GfVec3d::YAxis(), v.y)
-                        * GfRotation(GfVec3d::ZAxis(), v.z);
-                return GfQuath(rot.GetQuat());
-            });
+    if (hasRotation) {
+        VtQuathArray vtArray(rotation.length());
+        MayaUsdUtils::convertEulerXYZToQuath(
+            vtArray.data(), _GetArrayData(rotation), vtArray.size());
         SetAttribute(instancer.CreateOrientationsAttr(), vtArray, usdTime, valueWriter);
     }
     else {
@@ -1083,18 +1118,12 @@ UsdMayaWriteUtil::WriteArrayAttrsToInstancer(
         SetAttribute(instancer.CreateOrientationsAttr(), vtArray, usdTime, valueWriter);
     }
 
-    if (inputPointsData.checkArrayExist("scale", type) &&
-            type == MFnArrayAttrsData::kVectorArray) {
-        const MVectorArray scale = inputPointsData.vectorArray("scale",
-                &status);
-        CHECK_MSTATUS_AND_RETURN(status, false);
-
-        VtVec3fArray vtArray = _MapMayaToVtArray<
-            MVectorArray, const MVector&, GfVec3f>(
-            scale,
-            [](const MVector& v) {
-                return GfVec3f(v.x, v.y, v.z);
-            });
+    if (hasScale) {
+        VtVec3fArray vtArray(scale.length());
+        MayaUsdUtils::convertDoubleToFloat(
+            reinterpret_cast<float*>(vtArray.data()),
+            _GetArrayData(scale),
+            3 * vtArray.size());
         SetAttribute(instancer.CreateScalesAttr(), vtArray, usdTime, valueWriter);
     }
     else {
@@ -1107,12 +1136,7 @@ UsdMayaWriteUtil::WriteArrayAttrsToInstancer(
     // to each instance. USD stores visibility as a sparse array of only the
     // particular id's (or indices) to be invis'ed.
     // Visibility isn't required, so skip authoring if it doesn't exist.
-    if (inputPointsData.checkArrayExist("visibility", type) &&
-            type == MFnArrayAttrsData::kDoubleArray) {
-        const MDoubleArray visibility = inputPointsData.doubleArray(
-                "visibility", &status);
-        CHECK_MSTATUS_AND_RETURN(status, false);
-
+    if (hasVisibility) {
         VtInt64Array invisibleIds;
         for (size_t i = 0; i < visibility.length(); ++i) {
             if (visibility[i] == 0.0) {
@@ -525,6 +525,12 @@ MayaUsdProxyShapeBase::computeInStageDataCached(MDataBlock& dataBlock)
 
         inDataCachedHandle.copy(inDataHandle);
 
+        if (dataBlock.context().isNormal()) {
+            if (MayaUsdStageData* inData = dynamic_cast<MayaUsdStageData*>(inDataHandle.asPluginData())) {
+                _SetCacheUserStage(inData->stage);
+            }
+        }
+
         inDataCachedHandle.setClean();
         return MS::kSuccess;
     }
@@ -633,18 +639,14 @@ MayaUsdProxyShapeBase::computeInStageDataCached(MDataBlock& dataBlock)
                 
                 if (SdfLayerRefPtr rootLayer = SdfLayer::FindOrOpen(fileString)) {
                     SdfLayerRefPtr sessionLayer = computeSessionLayer(dataBlock);
-                    if (sessionLayer) {
-                        usdStage = UsdStage::Open(rootLayer,
-                                sessionLayer,
-                                ArGetResolver().GetCurrentContext(),
-                                loadSet);
-                    } else {
-                        usdStage = UsdStage::Open(rootLayer,
-                                ArGetResolver().GetCurrentContext(),
-                                loadSet);
-                    }
+                    usdStage = UsdMayaStageCache::Open(rootLayer,
+                            sessionLayer,
+                            ArGetResolver().GetCurrentContext(),
+                            loadSet);
 
-                    usdStage->SetEditTarget(usdStage->GetRootLayer());
+                    if (usdStage) {
+                        usdStage->SetEditTarget(usdStage->GetRootLayer());
+                    }
                 }
                 else {
                     // Create a new stage in memory with an anonymous root layer.
@@ -657,6 +659,8 @@ MayaUsdProxyShapeBase::computeInStageDataCached(MDataBlock& dataBlock)
             primPath = usdStage->GetPseudoRoot().GetPath();
         }
 
+        _SetCacheUserStage(usdStage);
+
         // Create the output outData ========
         MFnPluginData pluginDataFn;
         MObject stageDataObj =
@@ -894,8 +898,6 @@ MayaUsdProxyShapeBase::boundingBox() const
         return MBoundingBox();
     }
 
-    const UsdGeomImageable imageablePrim(prim);
-
     bool drawRenderPurpose = false;
     bool drawProxyPurpose = true;
     bool drawGuidePurpose = false;
@@ -905,20 +907,24 @@ MayaUsdProxyShapeBase::boundingBox() const
         &drawProxyPurpose,
         &drawGuidePurpose);
 
-    const TfToken purpose1 = UsdGeomTokens->default_;
-    const TfToken purpose2 =
-        drawRenderPurpose ? UsdGeomTokens->render : TfToken();
-    const TfToken purpose3 =
-        drawProxyPurpose ? UsdGeomTokens->proxy : TfToken();
-    const TfToken purpose4 =
-        drawGuidePurpose ? UsdGeomTokens->guide : TfToken();
+    TfTokenVector purposes { UsdGeomTokens->default_ };
+    if (drawRenderPurpose) {
+        purposes.push_back(UsdGeomTokens->render);
+    }
+    if (drawProxyPurpose) {
+        purposes.push_back(UsdGeomTokens->proxy);
+    }
+    if (drawGuidePurpose) {
+        purposes.push_back(UsdGeomTokens->guide);
+    }
 
-    const GfBBox3d allBox = imageablePrim.ComputeUntransformedBound(
+    // Models with an authored extentsHint are bounded from it, without
+    // visiting the prims below them.
+    UsdGeomBBoxCache bboxCache(
         currTime,
-        purpose1,
-        purpose2,
-        purpose3,
-        purpose4);
+        purposes,
+        /* useExtentsHint = */ true);
+    const GfBBox3d allBox = bboxCache.ComputeUntransformedBound(prim);
 
     MBoundingBox &retval = nonConstThis->_boundingBoxCache[currTime];
 
@@ -1284,9 +1290,21 @@ MayaUsdProxyShapeBase::MayaUsdProxyShapeBase(const bool enableUfeSelection) :
 /* virtual */
 MayaUsdProxyShapeBase::~MayaUsdProxyShapeBase()
 {
-    //
-    // empty
-    //
+    UsdMayaStageCache::RemoveStageUser(_cacheUserStage);
+}
+
+void
+MayaUsdProxyShapeBase::_SetCacheUserStage(const UsdStagePtr& stage)
+{
+    // Keep the stage this shape uses from being evicted from the stage cache
+    // when it is over its memory budget.
+    if (stage == _cacheUserStage) {
+        return;
+    }
+
+    UsdMayaStageCache::RemoveStageUser(_cacheUserStage);
+    UsdMayaStageCache::AddStageUser(stage);
+    _cacheUserStage = stage;
 }
 
 MSelectionMask
@@ -331,6 +331,8 @@ class MayaUsdProxyShapeBase : public MPxSurfaceShape,
                 bool* drawProxyPurpose,
                 bool* drawGuidePurpose) const;
 
+        void _SetCacheUserStage(const UsdStagePtr& stage);
+
         void _OnStageContentsChanged(
                 const UsdNotice::StageContentsChanged& notice);
         void _OnStageObjectsChanged(
@@ -344,6 +346,9 @@ class MayaUsdProxyShapeBase : public MPxSurfaceShape,
 
         MAYAUSD_NS::ProxyAccessor::Owner    _usdAccessor;
 
+        // Stage this shape is registered as a user of in UsdMayaStageCache.
+        UsdStagePtr                         _cacheUserStage;
+
         static ClosestPointDelegate _sharedClosestPointDelegate;
 
         // Whether or not the proxy shape has enabled UFE/subpath selection
@@ -38,7 +38,6 @@
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/stage.h>
-#include <pxr/usd/usd/stageCacheContext.h>
 
 #include <mayaUsd/nodes/stageData.h>
 #include <mayaUsd/utils/stageCache.h>
@@ -123,12 +122,14 @@ UsdMayaStageNode::compute(const MPlug& plug, MDataBlock& dataBlock)
         UsdStageRefPtr usdStage;
 
         if (SdfLayerRefPtr rootLayer = SdfLayer::FindOrOpen(usdFile)) {
-            const bool loadAll = true;
-            UsdStageCacheContext ctx(UsdMayaStageCache::Get(loadAll));
-            usdStage = UsdStage::Open(rootLayer,
-                                      ArGetResolver().GetCurrentContext());
-
-            usdStage->SetEditTarget(usdStage->GetRootLayer());
+            usdStage = UsdMayaStageCache::Open(rootLayer,
+                                               SdfLayerHandle(),
+                                               ArGetResolver().GetCurrentContext(),
+                                               UsdStage::InitialLoadSet::LoadAll);
+
+            if (usdStage) {
+                usdStage->SetEditTarget(usdStage->GetRootLayer());
+            }
         }
 
         SdfPath primPath;
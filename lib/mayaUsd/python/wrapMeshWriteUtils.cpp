@@ -13,16 +13,21 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //
+#include <cstring>
 #include <string>
 
 #include <boost/python/class.hpp>
 #include <boost/python.hpp>
 
+#include <maya/MFloatArray.h>
+#include <maya/MFloatPointArray.h>
 #include <maya/MFnMesh.h>
+#include <maya/MIntArray.h>
 #include <maya/MObject.h>
 #include <maya/MStatus.h>
 
 #include <pxr/pxr.h>
+#include <pxr/base/gf/vec2f.h>
 #include <pxr/base/gf/vec3f.h>
 #include <pxr/base/tf/pyResultConversions.h>
 #include <pxr/base/tf/token.h>
@@ -64,6 +69,321 @@ _GetMeshNormals(const std::string& meshDagPath)
     return make_tuple(normalsArray, interpolation);
 }
 
+// The bulk accessors below move whole arrays across the Python boundary. Reads
+// return Vt arrays, which expose the buffer protocol, so numpy.asarray() views
+// them without copying. Writes take any C-contiguous buffer (Vt arrays, numpy
+// arrays, array.array...) and read it in place.
+
+static
+bool
+_GetMeshFn(const std::string& meshDagPath, MFnMesh& meshFn)
+{
+    MObject meshObj;
+    MStatus status = UsdMayaUtil::GetMObjectByName(meshDagPath, meshObj);
+    if (status != MS::kSuccess) {
+        TF_CODING_ERROR("Could not get MObject for dagPath: %s",
+                        meshDagPath.c_str());
+        return false;
+    }
+
+    if (!meshObj.hasFn(MFn::kMesh) || meshFn.setObject(meshObj) != MS::kSuccess) {
+        TF_CODING_ERROR("MFnMesh() failed for object at dagPath: %s",
+                        meshDagPath.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+template <typename T>
+struct _BufferFormat;
+
+template <>
+struct _BufferFormat<float>
+{
+    static const char* codes() { return "f"; }
+};
+
+template <>
+struct _BufferFormat<int>
+{
+    static const char* codes() { return "il"; }
+};
+
+// Read-only view of a Python buffer holding tuples of componentCount values of
+// type T. The data is not copied.
+template <typename T>
+class _BufferView
+{
+public:
+    _BufferView(const object& obj, size_t componentCount, const char* name)
+        : _componentCount(componentCount)
+    {
+        if (PyObject_GetBuffer(obj.ptr(), &_view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0) {
+            PyErr_Clear();
+            TF_CODING_ERROR("%s does not support the buffer protocol", name);
+            return;
+        }
+        _hasView = true;
+
+        const char* format = _view.format ? _view.format : "B";
+        const char formatCode = format[std::strlen(format) - 1];
+        if (_view.itemsize != static_cast<Py_ssize_t>(sizeof(T))
+                || !std::strchr(_BufferFormat<T>::codes(), formatCode)) {
+            TF_CODING_ERROR("%s has format '%s', expected one of '%s' with %zu "
+                            "bytes per value", name, format,
+                            _BufferFormat<T>::codes(), sizeof(T));
+            return;
+        }
+
+        const size_t numValues = static_cast<size_t>(_view.len) / sizeof(T);
+        if (numValues % _componentCount != 0) {
+            TF_CODING_ERROR("%s has %zu values, expected a multiple of %zu",
+                            name, numValues, _componentCount);
+            return;
+        }
+
+        _size = numValues / _componentCount;
+        _valid = true;
+    }
+
+    ~_BufferView()
+    {
+        if (_hasView) {
+            PyBuffer_Release(&_view);
+        }
+    }
+
+    _BufferView(const _BufferView&) = delete;
+    _BufferView& operator=(const _BufferView&) = delete;
+
+    explicit operator bool() const { return _valid; }
+
+    // Number of tuples.
+    size_t size() const { return _size; }
+
+    const T* data() const { return static_cast<const T*>(_view.buf); }
+
+private:
+    Py_buffer _view;
+    size_t _componentCount;
+    size_t _size = 0;
+    bool _hasView = false;
+    bool _valid = false;
+};
+
+static
+VtVec3fArray
+_GetMeshPoints(const std::string& meshDagPath)
+{
+    MFnMesh meshFn;
+    if (!_GetMeshFn(meshDagPath, meshFn)) {
+        return VtVec3fArray();
+    }
+
+    MStatus status;
+    const float* pointsData = meshFn.getRawPoints(&status);
+    if (status != MS::kSuccess) {
+        TF_CODING_ERROR("Unable to access mesh vertices on mesh: %s",
+                        meshDagPath.c_str());
+        return VtVec3fArray();
+    }
+
+    VtVec3fArray points(meshFn.numVertices());
+    std::memcpy(points.data(), pointsData, sizeof(GfVec3f) * points.size());
+    return points;
+}
+
+static
+bool
+_SetMeshPoints(const std::string& meshDagPath, const object& pointsBuffer)
+{
+    MFnMesh meshFn;
+    if (!_GetMeshFn(meshDagPath, meshFn)) {
+        return false;
+    }
+
+    const _BufferView<float> points(pointsBuffer, 3, "points");
+    if (!points) {
+        return false;
+    }
+
+    const unsigned int numVertices = meshFn.numVertices();
+    if (points.size() != numVertices) {
+        TF_CODING_ERROR("Got %zu points for the %u vertices of mesh: %s",
+                        points.size(), numVertices, meshDagPath.c_str());
+        return false;
+    }
+
+    MFloatPointArray mayaPoints(numVertices);
+    const float* src = points.data();
+    for (unsigned int i = 0; i < numVertices; ++i, src += 3) {
+        mayaPoints.set(i, src[0], src[1], src[2]);
+    }
+
+    return meshFn.setPoints(mayaPoints) == MS::kSuccess;
+}
+
+static
+tuple
+_GetMeshFaceVertexIndices(const std::string& meshDagPath)
+{
+    VtIntArray faceVertexCounts;
+    VtIntArray faceVertexIndices;
+
+    MFnMesh meshFn;
+    if (!_GetMeshFn(meshDagPath, meshFn)) {
+        return make_tuple(faceVertexCounts, faceVertexIndices);
+    }
+
+    MIntArray mayaCounts;
+    MIntArray mayaIndices;
+    if (meshFn.getVertices(mayaCounts, mayaIndices) != MS::kSuccess) {
+        TF_CODING_ERROR("Unable to get face vertices of mesh: %s",
+                        meshDagPath.c_str());
+        return make_tuple(faceVertexCounts, faceVertexIndices);
+    }
+
+    faceVertexCounts.resize(mayaCounts.length());
+    mayaCounts.get(faceVertexCounts.data());
+    faceVertexIndices.resize(mayaIndices.length());
+    mayaIndices.get(faceVertexIndices.data());
+
+    return make_tuple(faceVertexCounts, faceVertexIndices);
+}
+
+// Returns the UV values of the set and the UV id of every face vertex, -1
+// for the face vertices of faces without UVs.
+static
+tuple
+_GetMeshUVs(const std::string& meshDagPath, const std::string& uvSetName)
+{
+    VtVec2fArray uvs;
+    VtIntArray uvIds;
+
+    MFnMesh meshFn;
+    if (!_GetMeshFn(meshDagPath, meshFn)) {
+        return make_tuple(uvs, uvIds);
+    }
+
+    const MString mayaUVSetName(uvSetName.c_str());
+    MFloatArray uArray;
+    MFloatArray vArray;
+    MIntArray vertexCounts;
+    MIntArray vertexList;
+    MIntArray uvCounts;
+    MIntArray assignedUVIds;
+    if (meshFn.getUVs(uArray, vArray, &mayaUVSetName) != MS::kSuccess
+            || meshFn.getVertices(vertexCounts, vertexList) != MS::kSuccess
+            || meshFn.getAssignedUVs(uvCounts, assignedUVIds, &mayaUVSetName) != MS::kSuccess
+            || uArray.length() != vArray.length()
+            || uvCounts.length() != vertexCounts.length()) {
+        TF_CODING_ERROR("Unable to get UV set '%s' of mesh: %s",
+                        uvSetName.c_str(), meshDagPath.c_str());
+        return make_tuple(uvs, uvIds);
+    }
+
+    uvs.resize(uArray.length());
+    GfVec2f* uvData = uvs.data();
+    for (unsigned int i = 0; i < uArray.length(); ++i) {
+        uvData[i].Set(uArray[i], vArray[i]);
+    }
+
+    // Faces are either fully mapped or not mapped at all.
+    uvIds.assign(vertexList.length(), -1);
+    int* dst = uvIds.data();
+    unsigned int assigned = 0;
+    for (unsigned int face = 0; face < vertexCounts.length(); ++face) {
+        const int count = vertexCounts[face];
+        if (uvCounts[face] == count) {
+            for (int i = 0; i < count; ++i) {
+                dst[i] = assignedUVIds[assigned++];
+            }
+        }
+        else {
+            assigned += uvCounts[face];
+        }
+        dst += count;
+    }
+
+    return make_tuple(uvs, uvIds);
+}
+
+// Replaces the UV values of the set and assigns them with the UV id of every
+// face vertex. Faces with a negative id are left without UVs.
+static
+bool
+_SetMeshUVs(
+    const std::string& meshDagPath,
+    const std::string& uvSetName,
+    const object& uvsBuffer,
+    const object& uvIdsBuffer)
+{
+    MFnMesh meshFn;
+    if (!_GetMeshFn(meshDagPath, meshFn)) {
+        return false;
+    }
+
+    const _BufferView<float> uvs(uvsBuffer, 2, "uvs");
+    const _BufferView<int> uvIds(uvIdsBuffer, 1, "uvIds");
+    if (!uvs || !uvIds) {
+        return false;
+    }
+
+    MIntArray vertexCounts;
+    MIntArray vertexList;
+    if (meshFn.getVertices(vertexCounts, vertexList) != MS::kSuccess) {
+        TF_CODING_ERROR("Unable to get face vertices of mesh: %s",
+                        meshDagPath.c_str());
+        return false;
+    }
+
+    if (uvIds.size() != vertexList.length()) {
+        TF_CODING_ERROR("Got %zu UV ids for the %u face vertices of mesh: %s",
+                        uvIds.size(), vertexList.length(), meshDagPath.c_str());
+        return false;
+    }
+
+    const unsigned int numUVs = static_cast<unsigned int>(uvs.size());
+    MFloatArray uArray(numUVs);
+    MFloatArray vArray(numUVs);
+    const float* uvData = uvs.data();
+    for (unsigned int i = 0; i < numUVs; ++i, uvData += 2) {
+        uArray[i] = uvData[0];
+        vArray[i] = uvData[1];
+    }
+
+    MIntArray uvCounts(vertexCounts.length(), 0);
+    MIntArray assignedUVIds;
+    assignedUVIds.setSizeIncrement(vertexList.length());
+    const int* ids = uvIds.data();
+    for (unsigned int face = 0; face < vertexCounts.length(); ++face) {
+        const int count = vertexCounts[face];
+        bool mapped = true;
+        for (int i = 0; i < count; ++i) {
+            if (ids[i] < 0) {
+                mapped = false;
+            }
+            else if (static_cast<unsigned int>(ids[i]) >= numUVs) {
+                TF_CODING_ERROR("UV id %d out of range for %u UVs", ids[i], numUVs);
+                return false;
+            }
+        }
+
+        if (mapped) {
+            uvCounts[face] = count;
+            for (int i = 0; i < count; ++i) {
+                assignedUVIds.append(ids[i]);
+            }
+        }
+        ids += count;
+    }
+
+    const MString mayaUVSetName(uvSetName.c_str());
+    return meshFn.setUVs(uArray, vArray, &mayaUVSetName) == MS::kSuccess
+        && meshFn.assignUVs(uvCounts, assignedUVIds, &mayaUVSetName) == MS::kSuccess;
+}
+
 // Dummy class for putting UsdMayaMeshWriteUtils namespace functions in a Python
 // MeshWriteUtils namespace.
 class DummyScopeClass{};
@@ -78,5 +398,20 @@ void wrapMeshWriteUtils()
         .def("GetMeshNormals", &_GetMeshNormals)
             .staticmethod("GetMeshNormals")
 
+        .def("GetMeshPoints", &_GetMeshPoints)
+            .staticmethod("GetMeshPoints")
+
+        .def("SetMeshPoints", &_SetMeshPoints)
+            .staticmethod("SetMeshPoints")
+
+        .def("GetMeshFaceVertexIndices", &_GetMeshFaceVertexIndices)
+            .staticmethod("GetMeshFaceVertexIndices")
+
+        .def("GetMeshUVs", &_GetMeshUVs)
+            .staticmethod("GetMeshUVs")
+
+        .def("SetMeshUVs", &_SetMeshUVs)
+            .staticmethod("SetMeshUVs")
+
         ;
 }
@@ -19,6 +19,7 @@
 
 #include <pxr/pxr.h>
 #include <pxr/base/tf/pyResultConversions.h>
+#include <pxr/usd/ar/resolver.h>
 
 #include <mayaUsd/utils/stageCache.h>
 
@@ -28,9 +29,25 @@ using namespace boost;
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
+namespace {
+
+UsdStageRefPtr _Open(
+    const SdfLayerHandle& rootLayer,
+    const SdfLayerHandle& sessionLayer,
+    bool loadAll)
+{
+    return UsdMayaStageCache::Open(
+        rootLayer,
+        sessionLayer,
+        ArGetResolver().GetCurrentContext(),
+        loadAll ? UsdStage::InitialLoadSet::LoadAll : UsdStage::InitialLoadSet::LoadNone);
+}
+
+} // namespace
+
 void wrapStageCache()
 {
-    class_<UsdMayaStageCache>("StageCache")
+    scope stageCache = class_<UsdMayaStageCache>("StageCache")
 
         .def("Get", &UsdMayaStageCache::Get,
              args("loadAll"),
@@ -38,5 +55,27 @@ void wrapStageCache()
         .staticmethod("Get")
         .def("Clear", &UsdMayaStageCache::Clear)
         .staticmethod("Clear")
+        .def("Open", &_Open,
+             (arg("rootLayer"), arg("sessionLayer") = SdfLayerHandle(), arg("loadAll") = true))
+        .staticmethod("Open")
+        .def("SetMemoryBudget", &UsdMayaStageCache::SetMemoryBudget, args("bytes"))
+        .staticmethod("SetMemoryBudget")
+        .def("GetMemoryBudget", &UsdMayaStageCache::GetMemoryBudget)
+        .staticmethod("GetMemoryBudget")
+        .def("AddStageUser", &UsdMayaStageCache::AddStageUser, args("stage"))
+        .staticmethod("AddStageUser")
+        .def("RemoveStageUser", &UsdMayaStageCache::RemoveStageUser, args("stage"))
+        .staticmethod("RemoveStageUser")
+        .def("GetStatistics", &UsdMayaStageCache::GetStatistics)
+        .staticmethod("GetStatistics")
+        .def("ResetStatistics", &UsdMayaStageCache::ResetStatistics)
+        .staticmethod("ResetStatistics")
+        ;
+
+    class_<UsdMayaStageCache::Statistics>("Statistics", no_init)
+        .def_readonly("hits", &UsdMayaStageCache::Statistics::hits)
+        .def_readonly("misses", &UsdMayaStageCache::Statistics::misses)
+        .def_readonly("evictions", &UsdMayaStageCache::Statistics::evictions)
+        .def_readonly("memoryUsage", &UsdMayaStageCache::Statistics::memoryUsage)
         ;
 }
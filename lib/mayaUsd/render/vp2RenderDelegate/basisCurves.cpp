@@ -31,6 +31,7 @@
 #include "bboxGeom.h"
 #include "debugCodes.h"
 #include "draw_item.h"
+#include "instanceCuller.h"
 #include "instancer.h"
 #include "material.h"
 #include "render_delegate.h"
@@ -106,6 +107,12 @@ namespace {
         //! Color array to support per-instance color and selection highlight.
         MFloatArray _instanceColors;
 
+        //! USD instance index of each instance transform, empty when no instance is culled.
+        std::vector<unsigned int> _instanceIndices;
+
+        //! If true, instance indices of the render item need to be updated
+        bool _instanceIndicesDirty{ false };
+
         //! If valid, new shader instance to set
         MHWRender::MShaderInstance* _shader{ nullptr };
 
@@ -1101,8 +1108,24 @@ HdVP2BasisCurves::_UpdateDrawItem(
         VtMatrix4dArray transforms = static_cast<HdVP2Instancer*>(instancer)->
             ComputeInstanceTransforms(id);
 
+        // Cull instances outside of the view before building instance data.
+        // The Rprim is registered so it gets synced again when the view
+        // changes, or when culling is deactivated for several views.
+        std::vector<unsigned int>& visibleInstances = stateToCommit._instanceIndices;
+        HdVP2InstanceCuller& instanceCuller = drawScene.GetInstanceCuller();
+        const bool cullInstances = instanceCuller.IsActive();
+        if (instanceCuller.IsEnabled()) {
+            instanceCuller.RegisterRprim(id);
+            if (cullInstances) {
+                instanceCuller.Cull(range, _sharedData.bounds.GetMatrix(),
+                    transforms, visibleInstances);
+            }
+            stateToCommit._instanceIndicesDirty = true;
+        }
+
         MMatrix instanceMatrix;
-        const unsigned int instanceCount = transforms.size();
+        const unsigned int instanceCount = cullInstances ?
+            visibleInstances.size() : transforms.size();
 
         if (0 == instanceCount) {
             instancerWithNoInstances = true;
@@ -1110,7 +1133,8 @@ HdVP2BasisCurves::_UpdateDrawItem(
         else {
             stateToCommit._instanceTransforms.setLength(instanceCount);
             for (unsigned int i = 0; i < instanceCount; ++i) {
-                transforms[i].Get(instanceMatrix.matrix);
+                const unsigned int index = cullInstances ? visibleInstances[i] : i;
+                transforms[index].Get(instanceMatrix.matrix);
                 stateToCommit._instanceTransforms[i] = worldMatrix * instanceMatrix;
             }
 
@@ -1128,7 +1152,7 @@ HdVP2BasisCurves::_UpdateDrawItem(
                 std::vector<unsigned char> colorIndices;
 
                 // Assign with the index to the dormant wireframe color by default.
-                colorIndices.resize(instanceCount, 0);
+                colorIndices.resize(transforms.size(), 0);
 
                 // Assign with the index to the active selection highlight color.
                 if (auto state = drawScene.GetActiveSelectionState(id)) {
@@ -1153,7 +1177,8 @@ HdVP2BasisCurves::_UpdateDrawItem(
                 unsigned int offset = 0;
 
                 for (unsigned int i = 0; i < instanceCount; ++i) {
-                    unsigned char colorIndex = colorIndices[i];
+                    const unsigned int index = cullInstances ? visibleInstances[i] : i;
+                    unsigned char colorIndex = colorIndices[index];
                     const MColor& color = colors[colorIndex];
                     for (unsigned int j = 0; j < kNumColorChannels; j++) {
                         stateToCommit._instanceColors[offset++] = color[j];
@@ -1161,6 +1186,11 @@ HdVP2BasisCurves::_UpdateDrawItem(
                 }
             }
         }
+
+        // Draw instance indices match USD instance indices if nothing was culled.
+        if (cullInstances && visibleInstances.size() == transforms.size()) {
+            visibleInstances.clear();
+        }
     }
     else {
         // Non-instanced Rprims.
@@ -1357,6 +1387,10 @@ HdVP2BasisCurves::_UpdateDrawItem(
                 vertexBuffers, *indexBuffer, stateToCommit._boundingBox);
         }
 
+        if (stateToCommit._instanceIndicesDirty) {
+            drawScene.UpdateInstanceIndices(renderItem->name(), stateToCommit._instanceIndices);
+        }
+
         // Important, update instance transforms after setting geometry on render items!
         auto& oldInstanceCount = stateToCommit._drawItemData._instanceCount;
         auto newInstanceCount = stateToCommit._instanceTransforms.length();
@@ -21,6 +21,7 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 TF_REGISTRY_FUNCTION(TfDebug)
 {
+    TF_DEBUG_ENVIRONMENT_SYMBOL(HDVP2_DEBUG_INSTANCE_CULLING, "Debug instance culling");
     TF_DEBUG_ENVIRONMENT_SYMBOL(HDVP2_DEBUG_MATERIAL, "Debug material");
     TF_DEBUG_ENVIRONMENT_SYMBOL(HDVP2_DEBUG_MESH, "Debug mesh");
 }
@@ -23,6 +23,7 @@
 PXR_NAMESPACE_OPEN_SCOPE
 
 TF_DEBUG_CODES(
+    HDVP2_DEBUG_INSTANCE_CULLING,
     HDVP2_DEBUG_MATERIAL,
     HDVP2_DEBUG_MESH
 );
@@ -0,0 +1,320 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "instanceCuller.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec4d.h>
+#include <pxr/base/tf/envSetting.h>
+
+#include <mayaUsdUtils/SIMD.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_DEFINE_ENV_SETTING(MAYAUSD_VP2_INSTANCE_CULLING, false,
+    "Cull native instances outside of the viewport in the VP2 render delegate.");
+
+TF_DEFINE_ENV_SETTING(MAYAUSD_VP2_INSTANCE_CULLING_MIN_PIXELS, 0,
+    "When instance culling is enabled, also cull instances whose bounding "
+    "sphere is projected to fewer pixels than this value. 0 disables it.");
+
+namespace {
+
+    //! Returns the largest scale factor of the upper 3x3 of a matrix.
+    double _GetMaxScale(const GfMatrix4d& m)
+    {
+        double maxLengthSq = 0.0;
+        for (int i = 0; i < 3; i++) {
+            const double lengthSq = m[i][0] * m[i][0] + m[i][1] * m[i][1] + m[i][2] * m[i][2];
+            maxLengthSq = std::max(maxLengthSq, lengthSq);
+        }
+        return std::sqrt(maxLengthSq);
+    }
+
+} // namespace
+
+//! \brief  Constructor. Reads env settings once.
+HdVP2InstanceCuller::HdVP2InstanceCuller()
+: HdVP2InstanceCuller(
+    TfGetEnvSetting(MAYAUSD_VP2_INSTANCE_CULLING),
+    TfGetEnvSetting(MAYAUSD_VP2_INSTANCE_CULLING_MIN_PIXELS))
+{
+}
+
+//! \brief  Constructor with explicit settings.
+HdVP2InstanceCuller::HdVP2InstanceCuller(bool enabled, int minPixels)
+: _minPixels(std::max(0, minPixels))
+, _enabled(enabled)
+{
+}
+
+/*! \brief  Extract frustum planes and LOD parameters from the matrices of a
+            single 3D view, and activate culling.
+
+    Call from main thread only, before Hydra sync.
+
+    \param  viewProjection  view projection matrix of the view, row vectors
+    \param  projection      projection matrix of the view, row vectors
+    \param  cameraPosition  world space position of the camera
+    \param  viewportHeight  height of the viewport in pixels
+
+    \return True if the view changed since the last call, in which case the
+            registered Rprims need to be synced again.
+*/
+bool HdVP2InstanceCuller::SetView(
+    const GfMatrix4d& viewProjection,
+    const GfMatrix4d& projection,
+    const GfVec3f& cameraPosition,
+    int viewportHeight)
+{
+    if (!_enabled) {
+        return false;
+    }
+
+    if (_active && viewProjection == _viewProjection &&
+        viewportHeight == _viewportHeight) {
+        return false;
+    }
+
+    _active = true;
+    _viewProjection = viewProjection;
+    _viewportHeight = viewportHeight;
+
+    // Maya matrices use row vectors, so clip = [x y z 1] * M and the planes
+    // are sums and differences of the matrix columns. The near plane is
+    // taken from the OpenGL depth range which also bounds the DirectX one.
+    const GfMatrix4d& m = viewProjection;
+    const int planeAxis[kNumPlanes] = { 0, 0, 1, 1, 2, 2 };
+    const double planeSign[kNumPlanes] = { 1.0, -1.0, 1.0, -1.0, 1.0, -1.0 };
+    for (size_t p = 0; p < kNumPlanes; p++) {
+        const int axis = planeAxis[p];
+        const double sign = planeSign[p];
+        GfVec4d plane(
+            m[0][3] + sign * m[0][axis],
+            m[1][3] + sign * m[1][axis],
+            m[2][3] + sign * m[2][axis],
+            m[3][3] + sign * m[3][axis]);
+
+        const double length = GfVec3d(plane[0], plane[1], plane[2]).GetLength();
+        if (length > 0.0) {
+            plane /= length;
+        }
+
+        _planeX[p] = float(plane[0]);
+        _planeY[p] = float(plane[1]);
+        _planeZ[p] = float(plane[2]);
+        _planeW[p] = float(plane[3]);
+    }
+
+    _cameraPosition = cameraPosition;
+
+    // The projected diameter of a sphere in pixels is roughly
+    // radius * projection[1][1] * height / distance. Orthographic views don't
+    // shrink with distance, skip size culling for them.
+    const bool isPerspective = (projection[3][3] == 0.0);
+    _lodScale = (_minPixels > 0 && isPerspective) ?
+        float(projection[1][1] * viewportHeight / _minPixels) : 0.0f;
+
+    return true;
+}
+
+/*! \brief  Deactivate culling because several 3D views are drawn.
+
+    Call from main thread only, before Hydra sync.
+
+    \return True if culling was active, in which case the registered Rprims
+            need to be synced again to draw all their instances.
+*/
+bool HdVP2InstanceCuller::SetMultipleViews()
+{
+    if (!_active) {
+        return false;
+    }
+
+    _active = false;
+    return true;
+}
+
+/*! \brief  Cull instances of an Rprim.
+
+    \param  localBounds         local space bounds of the Rprim
+    \param  worldMatrix         transform of the Rprim, applied before the instance transform
+    \param  instanceTransforms  transform of each instance
+    \param  visibleInstances    receives the indices of instances to draw, in increasing order
+*/
+void HdVP2InstanceCuller::Cull(
+    const GfRange3d& localBounds,
+    const GfMatrix4d& worldMatrix,
+    const VtMatrix4dArray& instanceTransforms,
+    std::vector<unsigned int>& visibleInstances)
+{
+    const size_t numInstances = instanceTransforms.size();
+    visibleInstances.clear();
+    visibleInstances.reserve(numInstances);
+
+    // Without bounds there is nothing to test against, keep all instances.
+    if (localBounds.IsEmpty()) {
+        for (size_t i = 0; i < numInstances; i++) {
+            visibleInstances.push_back(static_cast<unsigned int>(i));
+        }
+        _numVisibleInstances += numInstances;
+        return;
+    }
+
+    const GfVec3d center = worldMatrix.Transform(localBounds.GetMidpoint());
+    const double radius =
+        0.5 * localBounds.GetSize().GetLength() * _GetMaxScale(worldMatrix);
+
+    // Only the bounding sphere of each instance is transformed, full instance
+    // matrices are composed later for the visible instances only.
+    _InstanceSpheres& spheres = _spheres.local();
+    spheres.Resize(numInstances);
+    for (size_t i = 0; i < numInstances; i++) {
+        const GfMatrix4d& instanceMatrix = instanceTransforms[i];
+        const GfVec3d c = instanceMatrix.Transform(center);
+        spheres._x[i] = float(c[0]);
+        spheres._y[i] = float(c[1]);
+        spheres._z[i] = float(c[2]);
+        spheres._radius[i] = float(radius * _GetMaxScale(instanceMatrix));
+    }
+
+    const float* const x = spheres._x.data();
+    const float* const y = spheres._y.data();
+    const float* const z = spheres._z.data();
+    const float* const r = spheres._radius.data();
+
+    size_t i = 0;
+
+#if defined(__SSE__)
+
+    using namespace MayaUsdUtils;
+
+    const f128 zero = zero4f();
+    const f128 lodScale = splat4f(_lodScale);
+    const f128 camX = splat4f(_cameraPosition[0]);
+    const f128 camY = splat4f(_cameraPosition[1]);
+    const f128 camZ = splat4f(_cameraPosition[2]);
+
+    const size_t count4 = numInstances & ~size_t(3);
+    for (; i < count4; i += 4) {
+        const f128 cx = loadu4f(x + i);
+        const f128 cy = loadu4f(y + i);
+        const f128 cz = loadu4f(z + i);
+        const f128 cr = loadu4f(r + i);
+
+        f128 inside = cast4f(splat4i(-1));
+        for (size_t p = 0; p < kNumPlanes; p++) {
+            const f128 d = add4f(
+                add4f(mul4f(cx, splat4f(_planeX[p])), mul4f(cy, splat4f(_planeY[p]))),
+                add4f(mul4f(cz, splat4f(_planeZ[p])), add4f(splat4f(_planeW[p]), cr)));
+            inside = and4f(inside, cmpgt4f(d, zero));
+        }
+
+        if (_lodScale > 0.0f) {
+            const f128 dx = sub4f(cx, camX);
+            const f128 dy = sub4f(cy, camY);
+            const f128 dz = sub4f(cz, camZ);
+            const f128 distanceSq = add4f(add4f(mul4f(dx, dx), mul4f(dy, dy)), mul4f(dz, dz));
+            const f128 size = mul4f(cr, lodScale);
+            inside = and4f(inside, cmpgt4f(mul4f(size, size), distanceSq));
+        }
+
+        const int32_t mask = movemask4f(inside);
+        for (size_t j = 0; j < 4; j++) {
+            if (mask & (1 << j)) {
+                visibleInstances.push_back(static_cast<unsigned int>(i + j));
+            }
+        }
+    }
+
+#endif
+
+    for (; i < numInstances; i++) {
+        bool inside = true;
+        for (size_t p = 0; p < kNumPlanes && inside; p++) {
+            inside = (x[i] * _planeX[p] + y[i] * _planeY[p] + z[i] * _planeZ[p] +
+                _planeW[p] + r[i]) > 0.0f;
+        }
+
+        if (inside && _lodScale > 0.0f) {
+            const GfVec3f offset = GfVec3f(x[i], y[i], z[i]) - _cameraPosition;
+            const float size = r[i] * _lodScale;
+            inside = (size * size) > offset.GetLengthSq();
+        }
+
+        if (inside) {
+            visibleInstances.push_back(static_cast<unsigned int>(i));
+        }
+    }
+
+    _numVisibleInstances += visibleInstances.size();
+    _numCulledInstances += numInstances - visibleInstances.size();
+}
+
+//! \brief  Register an Rprim to be marked dirty when the view changes. Thread-safe.
+void HdVP2InstanceCuller::RegisterRprim(const SdfPath& id)
+{
+    std::lock_guard<std::mutex> lock(_rprimsMutex);
+    _rprims.insert(id);
+}
+
+//! \brief  Unregister an Rprim, e.g. when it is removed from the render index. Thread-safe.
+void HdVP2InstanceCuller::UnregisterRprim(const SdfPath& id)
+{
+    std::lock_guard<std::mutex> lock(_rprimsMutex);
+    _rprims.erase(id);
+}
+
+//! \brief  Returns a copy of the registered Rprims. Thread-safe.
+SdfPathVector HdVP2InstanceCuller::GetRegisteredRprims() const
+{
+    std::lock_guard<std::mutex> lock(_rprimsMutex);
+    return SdfPathVector(_rprims.begin(), _rprims.end());
+}
+
+/*! \brief  Record the USD instance index of each instance drawn by a render item.
+
+    An empty array means instances are not culled and draw instance indices
+    match USD instance indices. Call from main thread only.
+*/
+void HdVP2InstanceCuller::SetInstanceIndices(
+    const std::string& renderItemName,
+    const std::vector<unsigned int>& instanceIndices)
+{
+    if (instanceIndices.empty()) {
+        _instanceIndices.erase(renderItemName);
+    }
+    else {
+        _instanceIndices[renderItemName] = instanceIndices;
+    }
+}
+
+//! \brief  Map the index of a drawn instance to the index of the USD instance.
+int HdVP2InstanceCuller::GetUsdInstanceIndex(
+    const std::string& renderItemName,
+    int drawInstanceIndex) const
+{
+    const auto it = _instanceIndices.find(renderItemName);
+    if (it != _instanceIndices.end() && drawInstanceIndex >= 0 &&
+        static_cast<size_t>(drawInstanceIndex) < it->second.size()) {
+        return it->second[drawInstanceIndex];
+    }
+    return drawInstanceIndex;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
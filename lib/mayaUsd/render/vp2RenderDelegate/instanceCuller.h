@@ -0,0 +1,155 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_INSTANCE_CULLER
+#define HD_VP2_INSTANCE_CULLER
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <tbb/enumerable_thread_specific.h>
+
+#include <pxr/pxr.h>
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/usd/sdf/path.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  CPU culling of native instances against the view of the viewport.
+    \class  HdVP2InstanceCuller
+
+    Instanced Rprims hand VP2 one transform per instance. With large instance
+    counts most of them are often outside of the view, yet they would still
+    pay for transform math, upload and draw. The culler tests the bounding
+    sphere of each instance against the view frustum, four instances at a time,
+    and can optionally drop instances whose projected size is below a number
+    of pixels.
+
+    Culling is enabled with the MAYAUSD_VP2_INSTANCE_CULLING env setting and
+    the minimum projected size is set with MAYAUSD_VP2_INSTANCE_CULLING_MIN_PIXELS.
+
+    The view is set from main thread before Hydra sync, Cull() can be called
+    concurrently by Rprims being synced. Because the result depends on the
+    view, Rprims which used the culler register themselves so they can be
+    marked dirty when the view changes.
+
+    Render items are shared by all the viewports, so culling is only active
+    while a single 3D view is drawn: instances culled for one view would be
+    missing from the others.
+
+    The culler also maps the instances drawn by a render item back to the
+    USD instances, for selection.
+*/
+class HdVP2InstanceCuller final
+{
+public:
+    HdVP2InstanceCuller();
+    HdVP2InstanceCuller(bool enabled, int minPixels);
+    ~HdVP2InstanceCuller() = default;
+
+    //! Returns true if instance culling is enabled.
+    bool IsEnabled() const { return _enabled; }
+
+    //! Returns true if instances are culled for the current view.
+    bool IsActive() const { return _enabled && _active; }
+
+    bool SetView(
+        const GfMatrix4d& viewProjection,
+        const GfMatrix4d& projection,
+        const GfVec3f& cameraPosition,
+        int viewportHeight);
+
+    bool SetMultipleViews();
+
+    void Cull(
+        const GfRange3d& localBounds,
+        const GfMatrix4d& worldMatrix,
+        const VtMatrix4dArray& instanceTransforms,
+        std::vector<unsigned int>& visibleInstances);
+
+    void RegisterRprim(const SdfPath& id);
+    SdfPathVector GetRegisteredRprims() const;
+    void UnregisterRprim(const SdfPath& id);
+
+    void SetInstanceIndices(
+        const std::string& renderItemName,
+        const std::vector<unsigned int>& instanceIndices);
+    int GetUsdInstanceIndex(const std::string& renderItemName, int drawInstanceIndex) const;
+
+    //! Reset visible and culled instance counts.
+    void ResetStatistics() {
+        _numVisibleInstances = 0;
+        _numCulledInstances = 0;
+    }
+
+    //! Number of instances kept since the last reset of statistics.
+    size_t GetNumVisibleInstances() const { return _numVisibleInstances; }
+
+    //! Number of instances culled since the last reset of statistics.
+    size_t GetNumCulledInstances() const { return _numCulledInstances; }
+
+private:
+    static constexpr size_t kNumPlanes = 6;
+
+    //! Bounding spheres of instances in SoA form.
+    struct _InstanceSpheres {
+        std::vector<float> _x, _y, _z, _radius;
+
+        void Resize(size_t count) {
+            _x.resize(count);
+            _y.resize(count);
+            _z.resize(count);
+            _radius.resize(count);
+        }
+    };
+
+    //! Normalized frustum planes in SoA form, a point is inside the frustum
+    //! when x * _planeX + y * _planeY + z * _planeZ + _planeW > 0 for all planes.
+    float _planeX[kNumPlanes]{};
+    float _planeY[kNumPlanes]{};
+    float _planeZ[kNumPlanes]{};
+    float _planeW[kNumPlanes]{};
+
+    GfVec3f     _cameraPosition{ 0.0f };    //!< World space position of the camera
+    float       _lodScale{ 0.0f };          //!< Instances with radius * _lodScale below camera distance are culled, 0 to disable
+    GfMatrix4d  _viewProjection{ 0.0 };     //!< View projection matrix used to detect view changes
+    int         _viewportHeight{ 0 };       //!< Viewport height used to detect view changes
+    const int   _minPixels{ 0 };            //!< Minimum projected size in pixels, 0 to disable
+    const bool  _enabled{ false };          //!< Whether instance culling is enabled
+    bool        _active{ false };           //!< Whether instances are culled for the current view
+
+    //! Bounding spheres reused across calls, one buffer per sync thread
+    tbb::enumerable_thread_specific<_InstanceSpheres> _spheres;
+
+    std::atomic<size_t> _numVisibleInstances{ 0 };  //!< Statistics of visible instances
+    std::atomic<size_t> _numCulledInstances{ 0 };   //!< Statistics of culled instances
+
+    mutable std::mutex _rprimsMutex;                        //!< Protects _rprims from concurrent sync
+    std::unordered_set<SdfPath, SdfPath::Hash> _rprims;     //!< Rprims which need to be synced when the view changes
+
+    //! USD instance index of each instance drawn by a render item whose instances are culled
+    std::unordered_map<std::string, std::vector<unsigned int>> _instanceIndices;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_INSTANCE_CULLER
@@ -50,6 +50,7 @@
 #endif
 #include "debugCodes.h"
 #include "render_delegate.h"
+#include "shaderGraphCache.h"
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -705,6 +706,18 @@ HdVP2Material::_CreateShaderInstance(const HdMaterialNetwork& mat) {
         return nullptr;
     }
 
+    // Materials sharing the network topology share the fragment graph, only
+    // the parameters set by _UpdateShaderInstance() differ.
+    const std::string graphKey = HdVP2GetShaderGraphKey(mat);
+    if (!mat.nodes.empty()) {
+        MHWRender::MShaderInstance* shaderInstance =
+            _renderDelegate->AcquireShaderForGraph(graphKey);
+        if (shaderInstance) {
+            _surfaceShaderId = mat.nodes.back().path;
+            return shaderInstance;
+        }
+    }
+
     MHWRender::MShaderInstance* shaderInstance = nullptr;
 
     // MShaderInstance supports multiple connections between shaders on Maya 2018.7, 2019.3, 2020
@@ -887,6 +900,10 @@ HdVP2Material::_CreateShaderInstance(const HdMaterialNetwork& mat) {
 
 #endif
 
+    if (shaderInstance) {
+        _renderDelegate->AddShaderForGraph(graphKey, *shaderInstance);
+    }
+
     return shaderInstance;
 }
 
@@ -17,6 +17,7 @@
 
 #include <numeric>
 #include <type_traits>
+#include <vector>
 
 #include <maya/MMatrix.h>
 #include <maya/MProfiler.h>
@@ -24,6 +25,7 @@
 
 #include <pxr/base/gf/matrix4d.h>
 #include <pxr/imaging/hd/meshUtil.h>
+#include <pxr/imaging/hd/perfLog.h>
 #include <pxr/imaging/hd/sceneDelegate.h>
 #include <pxr/imaging/hd/smoothNormals.h>
 #include <pxr/imaging/hd/vertexAdjacency.h>
@@ -32,6 +34,7 @@
 #include "bboxGeom.h"
 #include "debugCodes.h"
 #include "draw_item.h"
+#include "instanceCuller.h"
 #include "instancer.h"
 #include "material.h"
 #include "render_delegate.h"
@@ -96,6 +99,12 @@ namespace {
         //! Color array to support per-instance color and selection highlight.
         MFloatArray _instanceColors;
 
+        //! USD instance index of each instance transform, empty when no instance is culled.
+        std::vector<unsigned int> _instanceIndices;
+
+        //! If true, instance indices of the render item need to be updated
+        bool _instanceIndicesDirty{ false };
+
         //! If valid, new shader instance to set
         MHWRender::MShaderInstance* _shader{ nullptr };
 
@@ -114,6 +123,8 @@ namespace {
     };
 
     //! Helper utility function to fill primvar data to vertex buffer.
+    //! The bytes filled are added to the vertexBufferUploadBytes perf counter,
+    //! once per buffer, so that vertex layouts can be compared on playback.
     template <class DEST_TYPE, class SRC_TYPE>
     void _FillPrimvarData(DEST_TYPE* vertexBuffer,
         size_t numVertices,
@@ -125,6 +136,11 @@ namespace {
         const VtArray<SRC_TYPE>& primvarData,
         const HdInterpolation& primvarInterp)
     {
+        if (channelOffset == 0) {
+            HD_PERF_COUNTER_ADD(HdVP2PerfTokens->vertexBufferUploadBytes,
+                static_cast<double>(sizeof(DEST_TYPE) * numVertices));
+        }
+
         switch (primvarInterp) {
         case HdInterpolationConstant:
             for (size_t v = 0; v < numVertices; v++) {
@@ -250,22 +266,6 @@ namespace {
         }
     }
 
-    //! If there is uniform or face-varying primvar, we have to create unshared
-    //! vertex layout on CPU because SSBO technique is not widely supported by
-    //! GPUs and 3D APIs.
-    bool _IsUnsharedVertexLayoutRequired(const PrimvarSourceMap& primvarSources)
-    {
-        for (const auto& it : primvarSources) {
-            const HdInterpolation interp = it.second.interpolation;
-            if (interp == HdInterpolationUniform ||
-                interp == HdInterpolationFaceVarying) {
-                return true;
-            }
-        }
-
-        return false;
-    }
-
     //! Helper utility function to get number of edge indices
     unsigned int _GetNumOfEdgeIndices(const HdMeshTopology& topology)
     {
@@ -363,8 +363,29 @@ void HdVP2Mesh::Sync(
             delegate->GetMaterialId(id));
     }
 
-    if (HdChangeTracker::IsPrimvarDirty(*dirtyBits, id, HdTokens->normals) ||
-        HdChangeTracker::IsPrimvarDirty(*dirtyBits, id, HdTokens->primvar)) {
+    const bool topologyDirty = HdChangeTracker::IsTopologyDirty(*dirtyBits, id);
+
+    // Primvars are welded against the topology, so it has to be pulled first.
+    // If it really changed, the welded primvars are stale and all of them
+    // need to be pulled again.
+    HdDirtyBits primvarDirtyBits = *dirtyBits;
+    if (topologyDirty) {
+        _meshSharedData._topology = GetMeshTopology(delegate);
+
+        // Topology can be marked dirty without actually changing, in which
+        // case the adjacency is still valid and doesn't need to be rebuilt.
+        // A new topology also starts over with the welded vertex layout.
+        if (_meshSharedData._vertexLayout.SetTopologyId(
+                _meshSharedData._topology.ComputeHash())) {
+            _meshSharedData._adjacency.reset();
+            primvarDirtyBits |= HdChangeTracker::DirtyNormals |
+                HdChangeTracker::DirtyPrimvar;
+        }
+        _meshSharedData._smoothNormals = VtVec3fArray();
+    }
+
+    if (HdChangeTracker::IsPrimvarDirty(primvarDirtyBits, id, HdTokens->normals) ||
+        HdChangeTracker::IsPrimvarDirty(primvarDirtyBits, id, HdTokens->primvar)) {
         const HdVP2Material* material = static_cast<const HdVP2Material*>(
             delegate->GetRenderIndex().GetSprim(
                 HdPrimTypeTokens->material, GetMaterialId())
@@ -374,11 +395,19 @@ void HdVP2Mesh::Sync(
             material && material->GetSurfaceShader() ?
             material->GetRequiredPrimvars() : sFallbackShaderPrimvars;
 
-        _UpdatePrimvarSources(delegate, *dirtyBits, requiredPrimvars);
+        _UpdatePrimvarSources(delegate, primvarDirtyBits, requiredPrimvars);
     }
 
-    if (HdChangeTracker::IsTopologyDirty(*dirtyBits, id)) {
-        _meshSharedData._topology = GetMeshTopology(delegate);
+    // The vertex layout depends on both topology and primvars. When a primvar
+    // change alone switches to the unshared layout, every vertex and index
+    // buffer has to be rebuilt as if the topology changed. This happens at
+    // most once per topology, the layout never switches back to welded.
+    HdVP2MeshVertexLayout& vertexLayout = _meshSharedData._vertexLayout;
+    const bool vertexLayoutChanged =
+        vertexLayout.Update(_meshSharedData._primvarSourceMap);
+
+    if (topologyDirty || vertexLayoutChanged) {
+        const bool unsharedVertexLayout = vertexLayout.IsUnshared();
 
         const HdMeshTopology& topology = _meshSharedData._topology;
         const VtIntArray& faceVertexIndices = topology.GetFaceVertexIndices();
@@ -387,8 +416,7 @@ void HdVP2Mesh::Sync(
         VtIntArray newFaceVertexIndices;
         newFaceVertexIndices.resize(numFaceVertexIndices);
 
-        if (_IsUnsharedVertexLayoutRequired(_meshSharedData._primvarSourceMap)) {
-            _meshSharedData._numVertices = numFaceVertexIndices;
+        if (unsharedVertexLayout) {
             _meshSharedData._renderingToSceneFaceVtxIds = faceVertexIndices;
 
             // Fill with sequentially increasing values, starting from 0. The new
@@ -400,7 +428,6 @@ void HdVP2Mesh::Sync(
             std::iota(newFaceVertexIndices.begin(), newFaceVertexIndices.end(), 0);
         }
         else {
-            _meshSharedData._numVertices = topology.GetNumPoints();
             _meshSharedData._renderingToSceneFaceVtxIds.clear();
 
             // Allocate large enough memory with initial value of -1 to indicate
@@ -424,6 +451,13 @@ void HdVP2Mesh::Sync(
             }
         }
 
+        _meshSharedData._numVertices = vertexLayout.GetNumVertices(topology);
+
+        TF_DEBUG(HDVP2_DEBUG_MESH).Msg("%s: %s vertex layout, %zu vertices "
+            "for %d points\n", _rprimId.asChar(),
+            unsharedVertexLayout ? "unshared" : "welded",
+            _meshSharedData._numVertices, topology.GetNumPoints());
+
         _meshSharedData._renderingTopology = HdMeshTopology(
             topology.GetScheme(),
             topology.GetOrientation(),
@@ -431,14 +465,25 @@ void HdVP2Mesh::Sync(
             newFaceVertexIndices,
             topology.GetHoleIndices(),
             topology.GetRefineLevel());
+
+        if (vertexLayoutChanged) {
+            _MarkVertexLayoutDirty();
+        }
     }
 
     // Prepare position buffer. It is shared among all draw items so it should
     // be updated only once when it gets dirty.
-    if (HdChangeTracker::IsPrimvarDirty(*dirtyBits, id, HdTokens->points)) {
+    const bool pointsDirty =
+        HdChangeTracker::IsPrimvarDirty(*dirtyBits, id, HdTokens->points);
+    if (pointsDirty) {
         const VtValue value = delegate->Get(id, HdTokens->points);
         _meshSharedData._points = value.Get<VtVec3fArray>();
+        _meshSharedData._smoothNormals = VtVec3fArray();
+    }
 
+    // The rendering topology orders vertices differently from the scene
+    // topology, so positions are refilled whenever it is rebuilt.
+    if (pointsDirty || topologyDirty || vertexLayoutChanged) {
         const HdMeshTopology& topology = _meshSharedData._topology;
         const size_t numVertices = _meshSharedData._numVertices;
 
@@ -601,6 +646,37 @@ HdDirtyBits HdVP2Mesh::_PropagateDirtyBits(HdDirtyBits bits) const {
     return bits;
 }
 
+/*! \brief  Mark all draw items dirty after a change of vertex layout.
+
+    Switching between welded and unshared vertex layouts changes the number
+    and order of vertices, so every draw item, including those of reprs not
+    being synced right now, has to refill its index and vertex buffers.
+*/
+void HdVP2Mesh::_MarkVertexLayoutDirty()
+{
+    const HdDirtyBits bits = HdChangeTracker::DirtyTopology |
+        HdChangeTracker::DirtyPoints |
+        HdChangeTracker::DirtyNormals |
+        HdChangeTracker::DirtyPrimvar |
+        (_customDirtyBitsInUse & (DirtySmoothNormals | DirtyFlatNormals));
+
+    for (const std::pair<TfToken, HdReprSharedPtr>& pair : _reprs) {
+        const HdReprSharedPtr& repr = pair.second;
+        const auto& items = repr->GetDrawItems();
+#if HD_API_VERSION < 35
+        for (HdDrawItem* item : items) {
+            if (HdVP2DrawItem* drawItem = static_cast<HdVP2DrawItem*>(item)) {
+#else
+        for (const HdRepr::DrawItemUniquePtr &item : items) {
+            if (HdVP2DrawItem* const drawItem =
+                        static_cast<HdVP2DrawItem*>(item.get())) {
+#endif
+                drawItem->SetDirtyBits(bits);
+            }
+        }
+    }
+}
+
 /*! \brief  Initialize the given representation of this Rprim.
 
     This is called prior to syncing the prim, the first time the repr
@@ -808,6 +884,38 @@ void HdVP2Mesh::_UpdateRepr(HdSceneDelegate *sceneDelegate, const TfToken& reprT
     }
 }
 
+/*! \brief  Returns smooth normals computed from the cached points.
+
+    The normals are computed on first request after points or topology change
+    and then reused by every draw item of every repr. The vertex adjacency they
+    are computed from is only rebuilt when the topology changes.
+*/
+const VtVec3fArray& HdVP2Mesh::_GetSmoothNormals()
+{
+    if (_meshSharedData._smoothNormals.empty() &&
+        !_meshSharedData._points.empty()) {
+        MProfilingScope profilingScope(HdVP2RenderDelegate::sProfilerCategory,
+            MProfiler::kColorC_L2, _rprimId.asChar(), "ComputeSmoothNormals");
+
+        if (!_meshSharedData._adjacency) {
+            _meshSharedData._adjacency.reset(new Hd_VertexAdjacency());
+            HdBufferSourceSharedPtr adjacencyComputation =
+                _meshSharedData._adjacency->GetSharedAdjacencyBuilderComputation(
+                    &_meshSharedData._topology);
+            adjacencyComputation->Resolve();
+        }
+
+        // Only the points referenced by the topology are used to compute
+        // smooth normals.
+        _meshSharedData._smoothNormals = Hd_SmoothNormals::ComputeSmoothNormals(
+            _meshSharedData._adjacency.get(),
+            _meshSharedData._points.size(),
+            _meshSharedData._points.cdata());
+    }
+
+    return _meshSharedData._smoothNormals;
+}
+
 /*! \brief  Update the draw item
 
     This call happens on worker threads and results of the change are collected
@@ -915,17 +1023,7 @@ void HdVP2Mesh::_UpdateDrawItem(
             // at change tracker.
             // HdC_TODO: move the normals computation to GPU to save expensive
             // computation and buffer transfer.
-            Hd_VertexAdjacencySharedPtr adjacency(new Hd_VertexAdjacency());
-            HdBufferSourceSharedPtr adjacencyComputation =
-                adjacency->GetSharedAdjacencyBuilderComputation(&topology);
-            adjacencyComputation->Resolve(); // IS the adjacency updated now?
-
-            // Only the points referenced by the topology are used to compute
-            // smooth normals.
-            normals = Hd_SmoothNormals::ComputeSmoothNormals(
-                adjacency.get(),
-                _meshSharedData._points.size(),
-                _meshSharedData._points.cdata());
+            normals = _GetSmoothNormals();
 
             interp = HdInterpolationVertex;
 
@@ -1264,8 +1362,24 @@ void HdVP2Mesh::_UpdateDrawItem(
         VtMatrix4dArray transforms = static_cast<HdVP2Instancer*>(instancer)->
             ComputeInstanceTransforms(id);
 
+        // Cull instances outside of the view before building instance data.
+        // The Rprim is registered so it gets synced again when the view
+        // changes, or when culling is deactivated for several views.
+        std::vector<unsigned int>& visibleInstances = stateToCommit._instanceIndices;
+        HdVP2InstanceCuller& instanceCuller = drawScene.GetInstanceCuller();
+        const bool cullInstances = instanceCuller.IsActive();
+        if (instanceCuller.IsEnabled()) {
+            instanceCuller.RegisterRprim(id);
+            if (cullInstances) {
+                instanceCuller.Cull(range, _sharedData.bounds.GetMatrix(),
+                    transforms, visibleInstances);
+            }
+            stateToCommit._instanceIndicesDirty = true;
+        }
+
         MMatrix instanceMatrix;
-        const unsigned int instanceCount = transforms.size();
+        const unsigned int instanceCount = cullInstances ?
+            visibleInstances.size() : transforms.size();
 
         if (0 == instanceCount) {
             instancerWithNoInstances = true;
@@ -1273,7 +1387,8 @@ void HdVP2Mesh::_UpdateDrawItem(
         else if (!drawItem->ContainsUsage(HdVP2DrawItem::kSelectionHighlight)) {
             stateToCommit._instanceTransforms.setLength(instanceCount);
             for (unsigned int i = 0; i < instanceCount; ++i) {
-                transforms[i].Get(instanceMatrix.matrix);
+                const unsigned int index = cullInstances ? visibleInstances[i] : i;
+                transforms[index].Get(instanceMatrix.matrix);
                 stateToCommit._instanceTransforms[i] = worldMatrix * instanceMatrix;
             }
         }
@@ -1286,7 +1401,8 @@ void HdVP2Mesh::_UpdateDrawItem(
             stateToCommit._instanceColors.setLength(instanceCount * kNumColorChannels);
 
             for (unsigned int i = 0; i < instanceCount; ++i) {
-                transforms[i].Get(instanceMatrix.matrix);
+                const unsigned int index = cullInstances ? visibleInstances[i] : i;
+                transforms[index].Get(instanceMatrix.matrix);
                 stateToCommit._instanceTransforms[i] = worldMatrix * instanceMatrix;
 
                 for (unsigned int j = 0; j < kNumColorChannels; j++) {
@@ -1305,7 +1421,7 @@ void HdVP2Mesh::_UpdateDrawItem(
             std::vector<unsigned char> colorIndices;
 
             // Assign with the index to the dormant wireframe color by default.
-            colorIndices.resize(instanceCount, 0);
+            colorIndices.resize(transforms.size(), 0);
 
             // Assign with the index to the active selection highlight color.
             if (const auto state = drawScene.GetActiveSelectionState(id)) {
@@ -1327,12 +1443,18 @@ void HdVP2Mesh::_UpdateDrawItem(
 
             // Fill per-instance colors. Skip unselected instances for the dedicated selection
             // highlight item.
+            std::vector<unsigned int> drawnInstances;
             for (unsigned int i = 0; i < instanceCount; i++) {
-                unsigned char colorIndex = colorIndices[i];
+                const unsigned int index = cullInstances ? visibleInstances[i] : i;
+                unsigned char colorIndex = colorIndices[index];
                 if (isDedicatedSelectionHighlightItem && colorIndex == 0)
                     continue;
 
-                transforms[i].Get(instanceMatrix.matrix);
+                if (cullInstances) {
+                    drawnInstances.push_back(index);
+                }
+
+                transforms[index].Get(instanceMatrix.matrix);
                 stateToCommit._instanceTransforms.append(worldMatrix * instanceMatrix);
 
                 const MColor& color = colors[colorIndex];
@@ -1340,6 +1462,15 @@ void HdVP2Mesh::_UpdateDrawItem(
                     stateToCommit._instanceColors.append(color[j]);
                 }
             }
+
+            if (cullInstances) {
+                visibleInstances.swap(drawnInstances);
+            }
+        }
+
+        // Draw instance indices match USD instance indices if nothing was culled.
+        if (cullInstances && visibleInstances.size() == transforms.size()) {
+            visibleInstances.clear();
         }
     }
     else {
@@ -1488,6 +1619,10 @@ void HdVP2Mesh::_UpdateDrawItem(
                 vertexBuffers, *indexBuffer, stateToCommit._boundingBox);
         }
 
+        if (stateToCommit._instanceIndicesDirty) {
+            drawScene.UpdateInstanceIndices(renderItem->name(), stateToCommit._instanceIndices);
+        }
+
         // Important, update instance transforms after setting geometry on render items!
         auto& oldInstanceCount = stateToCommit._drawItemData._instanceCount;
         auto newInstanceCount = stateToCommit._instanceTransforms.length();
@@ -1580,6 +1715,9 @@ void HdVP2Mesh::_HideAllDrawItems(const TfToken& reprToken) {
 /*! \brief  Update _primvarSourceMap, our local cache of raw primvar data.
 
     This function pulls data from the scene delegate, but defers processing.
+    Face-varying and uniform primvars are welded to vertex and constant
+    interpolation when their data allows it, see HdVP2WeldPrimvarSource,
+    unless the topology already uses the unshared vertex layout.
 
     While iterating primvars, we skip "points" (vertex positions) because
     the points primvar is processed separately for direct access later. We
@@ -1603,8 +1741,11 @@ void HdVP2Mesh::_UpdatePrimvarSources(
         for (const HdPrimvarDescriptor& pv: primvars) {
             if (std::find(begin, end, pv.name) != end) {
                 if (HdChangeTracker::IsPrimvarDirty(dirtyBits, id, pv.name)) {
-                    const VtValue value = GetPrimvar(sceneDelegate, pv.name);
-                    _meshSharedData._primvarSourceMap[pv.name] = { value, interp };
+                    PrimvarSource source = { GetPrimvar(sceneDelegate, pv.name), interp };
+                    if (_meshSharedData._vertexLayout.ShouldWeldPrimvars()) {
+                        HdVP2WeldPrimvarSource(source, _meshSharedData._topology);
+                    }
+                    _meshSharedData._primvarSourceMap[pv.name] = source;
                 }
             }
             else {
@@ -20,24 +20,18 @@
 
 #include <pxr/pxr.h>
 #include <pxr/imaging/hd/mesh.h>
+#include <pxr/imaging/hd/vertexAdjacency.h>
 
 #include <mayaUsd/render/vp2RenderDelegate/proxyRenderDelegate.h>
 
+#include "meshVertexLayout.h"
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 class HdSceneDelegate;
 class HdVP2DrawItem;
 class HdVP2RenderDelegate;
 
-//! Primvar data and interpolation.
-struct PrimvarSource {
-    VtValue data;
-    HdInterpolation interpolation;
-};
-
-//! A hash map of primvar scene data using primvar name as the key.
-typedef TfHashMap<TfToken, PrimvarSource, TfToken::HashFunctor> PrimvarSourceMap;
-
 /*! \brief  HdVP2Mesh-specific data shared among all its draw items.
     \class  HdVP2MeshSharedData
 
@@ -71,6 +65,20 @@ struct HdVP2MeshSharedData {
     //! but a separate VtArray for easier access.
     VtVec3fArray _points;
 
+    //! Vertex adjacency of the scene topology, used to compute smooth normals.
+    //! It only depends on topology, so it is kept across point changes and
+    //! rebuilt only when the topology hash changes.
+    Hd_VertexAdjacencySharedPtr _adjacency;
+
+    //! Vertex layout of the rendering topology. It also holds the hash of the
+    //! cached topology, used to detect whether a dirty topology really changed.
+    HdVP2MeshVertexLayout _vertexLayout;
+
+    //! Smooth normals computed from points and adjacency. They are computed
+    //! once per Rprim and shared by all draw items of all reprs; empty when
+    //! they need to be recomputed.
+    VtVec3fArray _smoothNormals;
+
     //! Position buffer of the Rprim to be shared among all its draw items.
     std::unique_ptr<MHWRender::MVertexBuffer> _positionsBuffer;
 
@@ -119,6 +127,10 @@ private:
 
     void _HideAllDrawItems(const TfToken& reprToken);
 
+    void _MarkVertexLayoutDirty();
+
+    const VtVec3fArray& _GetSmoothNormals();
+
     void _UpdatePrimvarSources(
         HdSceneDelegate* sceneDelegate,
         HdDirtyBits dirtyBits,
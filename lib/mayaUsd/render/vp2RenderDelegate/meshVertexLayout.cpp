@@ -0,0 +1,178 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "meshVertexLayout.h"
+
+#include <vector>
+
+#include <pxr/base/gf/vec2f.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/gf/vec4f.h>
+#include <pxr/base/vt/array.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+    //! Helper utility function to weld a face-varying primvar into a vertex
+    //! primvar. Returns false if face-vertices sharing a point carry different
+    //! values.
+    template <class T>
+    bool _WeldFaceVaryingPrimvar(
+        const VtArray<T>& faceVaryingData,
+        const HdMeshTopology& topology,
+        VtValue& weldedData)
+    {
+        const VtIntArray& faceVertexIndices = topology.GetFaceVertexIndices();
+        const size_t numFaceVertexIndices = faceVertexIndices.size();
+        if (numFaceVertexIndices == 0 ||
+            faceVaryingData.size() != numFaceVertexIndices) {
+            return false;
+        }
+
+        const int numPoints = topology.GetNumPoints();
+        VtArray<T> vertexData(numPoints);
+        T* const vertexValues = vertexData.data();
+        const T* const faceVaryingValues = faceVaryingData.cdata();
+        const int* const indices = faceVertexIndices.cdata();
+
+        std::vector<bool> assigned(numPoints, false);
+        for (size_t i = 0; i < numFaceVertexIndices; i++) {
+            const int point = indices[i];
+            if (point < 0 || point >= numPoints) {
+                return false;
+            }
+
+            if (!assigned[point]) {
+                vertexValues[point] = faceVaryingValues[i];
+                assigned[point] = true;
+            }
+            else if (vertexValues[point] != faceVaryingValues[i]) {
+                return false;
+            }
+        }
+
+        weldedData = VtValue(vertexData);
+        return true;
+    }
+
+    //! Helper utility function to turn a uniform primvar holding the same value
+    //! for every face into a constant primvar. Returns false if the faces don't
+    //! all share the same value.
+    template <class T>
+    bool _WeldUniformPrimvar(
+        const VtArray<T>& uniformData,
+        const HdMeshTopology& topology,
+        VtValue& weldedData)
+    {
+        const size_t numFaces = topology.GetFaceVertexCounts().size();
+        if (numFaces == 0 || uniformData.size() < numFaces) {
+            return false;
+        }
+
+        const T* const values = uniformData.cdata();
+        for (size_t f = 1; f < numFaces; f++) {
+            if (values[f] != values[0]) {
+                return false;
+            }
+        }
+
+        weldedData = VtValue(VtArray<T>(1, values[0]));
+        return true;
+    }
+
+    template <class T>
+    bool _WeldPrimvar(
+        const VtValue& data,
+        HdInterpolation interpolation,
+        const HdMeshTopology& topology,
+        VtValue& weldedData)
+    {
+        if (!data.IsHolding<VtArray<T>>()) {
+            return false;
+        }
+
+        const VtArray<T>& array = data.UncheckedGet<VtArray<T>>();
+        return (interpolation == HdInterpolationFaceVarying) ?
+            _WeldFaceVaryingPrimvar(array, topology, weldedData) :
+            _WeldUniformPrimvar(array, topology, weldedData);
+    }
+
+} // anonymous namespace
+
+bool HdVP2WeldPrimvarSource(PrimvarSource& source, const HdMeshTopology& topology)
+{
+    const HdInterpolation interp = source.interpolation;
+    if (interp != HdInterpolationFaceVarying &&
+        interp != HdInterpolationUniform) {
+        return false;
+    }
+
+    VtValue weldedData;
+    if (_WeldPrimvar<GfVec3f>(source.data, interp, topology, weldedData) ||
+        _WeldPrimvar<GfVec2f>(source.data, interp, topology, weldedData) ||
+        _WeldPrimvar<float>(source.data, interp, topology, weldedData) ||
+        _WeldPrimvar<GfVec4f>(source.data, interp, topology, weldedData)) {
+        source.data = weldedData;
+        source.interpolation = (interp == HdInterpolationFaceVarying) ?
+            HdInterpolationVertex : HdInterpolationConstant;
+        return true;
+    }
+
+    return false;
+}
+
+bool HdVP2IsUnsharedVertexLayoutRequired(const PrimvarSourceMap& primvarSources)
+{
+    for (const auto& it : primvarSources) {
+        const HdInterpolation interp = it.second.interpolation;
+        if (interp == HdInterpolationUniform ||
+            interp == HdInterpolationFaceVarying) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool HdVP2MeshVertexLayout::SetTopologyId(HdMeshTopology::ID topologyId)
+{
+    if (topologyId == _topologyId) {
+        return false;
+    }
+
+    _topologyId = topologyId;
+    _unshared = false;
+    return true;
+}
+
+bool HdVP2MeshVertexLayout::Update(const PrimvarSourceMap& primvarSources)
+{
+    if (_unshared || !HdVP2IsUnsharedVertexLayoutRequired(primvarSources)) {
+        return false;
+    }
+
+    _unshared = true;
+    return true;
+}
+
+size_t HdVP2MeshVertexLayout::GetNumVertices(const HdMeshTopology& topology) const
+{
+    return _unshared ?
+        topology.GetFaceVertexIndices().size() :
+        static_cast<size_t>(topology.GetNumPoints());
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,108 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_MESH_VERTEX_LAYOUT
+#define HD_VP2_MESH_VERTEX_LAYOUT
+
+#include <cstddef>
+
+#include <pxr/pxr.h>
+#include <pxr/base/tf/hashmap.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/vt/value.h>
+#include <pxr/imaging/hd/enums.h>
+#include <pxr/imaging/hd/meshTopology.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+//! Primvar data and interpolation.
+struct PrimvarSource {
+    VtValue data;
+    HdInterpolation interpolation;
+};
+
+//! A hash map of primvar scene data using primvar name as the key.
+typedef TfHashMap<TfToken, PrimvarSource, TfToken::HashFunctor> PrimvarSourceMap;
+
+/*! \brief  Lowers the interpolation of a face-varying or uniform primvar when
+            its data allows it.
+
+    A face-varying primvar is welded to vertex interpolation when all the
+    face-vertices sharing a point carry the same value, which is typical for
+    normals of smooth meshes and for UVs without seams. A uniform primvar is
+    welded to constant interpolation when all the faces carry the same value.
+    Only float, GfVec2f, GfVec3f and GfVec4f arrays are considered.
+
+    Returns true if the primvar was welded.
+*/
+bool HdVP2WeldPrimvarSource(PrimvarSource& source, const HdMeshTopology& topology);
+
+/*! \brief  Returns true if a primvar of the map requires the unshared vertex
+            layout, i.e. has face-varying or uniform interpolation.
+
+    The unshared layout is created on CPU because the SSBO technique is not
+    widely supported by GPUs and 3D APIs.
+*/
+bool HdVP2IsUnsharedVertexLayoutRequired(const PrimvarSourceMap& primvarSources);
+
+/*! \brief  Vertex layout of the rendering topology of a mesh.
+    \class  HdVP2MeshVertexLayout
+
+    The welded layout shares one vertex per point of the topology and is the
+    default. The unshared layout has one vertex per face-vertex, roughly four
+    times as many for a quad mesh, and is only used once a primvar of the
+    mesh can't be welded.
+
+    The decision is kept for as long as the topology doesn't change: once a
+    topology requires the unshared layout, primvars are no longer welded and
+    the layout doesn't switch back. This way primvars animated between
+    weldable and non-weldable values don't rebuild every buffer of the mesh
+    on every frame.
+*/
+class HdVP2MeshVertexLayout final
+{
+public:
+    //! Sets the hash of the scene topology. Returns true and goes back to the
+    //! welded layout if it differs from the previous one.
+    bool SetTopologyId(HdMeshTopology::ID topologyId);
+
+    //! Returns the hash of the scene topology.
+    HdMeshTopology::ID GetTopologyId() const { return _topologyId; }
+
+    //! Switches to the unshared layout if the primvars require it. Returns
+    //! true if the layout changed.
+    bool Update(const PrimvarSourceMap& primvarSources);
+
+    //! Returns true if face-varying and uniform primvars should be welded
+    //! before being cached, which is pointless with the unshared layout.
+    bool ShouldWeldPrimvars() const { return !_unshared; }
+
+    //! Returns true if the layout is unshared.
+    bool IsUnshared() const { return _unshared; }
+
+    //! Returns the number of vertices of each vertex buffer for the topology.
+    size_t GetNumVertices(const HdMeshTopology& topology) const;
+
+private:
+    //! Hash of the scene topology the layout was decided for.
+    HdMeshTopology::ID _topologyId{ 0 };
+
+    //! Whether the rendering topology uses unshared vertex layout.
+    bool _unshared{ false };
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_MESH_VERTEX_LAYOUT
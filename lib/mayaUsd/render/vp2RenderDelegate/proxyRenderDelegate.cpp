@@ -15,6 +15,7 @@
 //
 #include "proxyRenderDelegate.h"
 
+#include <maya/M3dView.h>
 #include <maya/MFileIO.h>
 #include <maya/MFnPluginData.h>
 #include <maya/MHWGeometryUtilities.h>
@@ -42,6 +43,8 @@
 #include <mayaUsd/nodes/stageData.h>
 #include <mayaUsd/utils/util.h>
 
+#include "debugCodes.h"
+#include "instanceCuller.h"
 #include "render_delegate.h"
 #include "tokens.h"
 
@@ -306,6 +309,20 @@ bool _DrawItemFilterPredicate(const SdfPath& rprimID, const void* predicateParam
     return (passedRenderTagFilter && passedMaterialTagFilter);
 }
 
+//! \brief  Returns the number of visible 3D views.
+unsigned int _GetNumVisible3dViews()
+{
+    unsigned int numVisibleViews = 0;
+    const unsigned int numViews = M3dView::numberOf3dViews();
+    for (unsigned int i = 0; i < numViews; i++) {
+        M3dView view;
+        if (M3dView::get3dView(i, view) && view.isVisible()) {
+            numVisibleViews++;
+        }
+    }
+    return numVisibleViews;
+}
+
 } // namespace
 
 //! \brief  Draw classification used during plugin load to register in VP2
@@ -327,6 +344,7 @@ ProxyRenderDelegate::ProxyRenderDelegate(const MObject& obj)
 
     const MFnDependencyNode fnDepNode(obj);
     _proxyShapeData.reset(new ProxyShapeData(static_cast<MayaUsdProxyShapeBase*>(fnDepNode.userNode()), proxyDagPath));
+    _instanceCuller.reset(new HdVP2InstanceCuller());
 }
 
 //! \brief  Destructor
@@ -374,6 +392,7 @@ void ProxyRenderDelegate::_ClearRenderDelegate()
     _visibilityVersion = 0;
     _taskRenderTagsValid = false;
     _isPopulated = false;
+    _culledInstanceIndices.clear();
 }
 
 //! \brief  Clear data which is now stale because proxy shape attributes have changed
@@ -567,6 +586,53 @@ void ProxyRenderDelegate::_UpdateSceneDelegate()
     }
 }
 
+//! \brief  Update the view used for instance culling, Rprims which culled instances are synced again when it changes.
+void ProxyRenderDelegate::_UpdateInstanceCulling(const MHWRender::MFrameContext& frameContext)
+{
+    _instanceCuller->ResetStatistics();
+
+    if (!_instanceCuller->IsEnabled()) {
+        return;
+    }
+
+    // Render items are shared by all the viewports and each viewport updates
+    // them with its own view, so don't cull when several 3D views are drawn.
+    bool viewChanged = false;
+    if (_GetNumVisible3dViews() > 1) {
+        viewChanged = _instanceCuller->SetMultipleViews();
+    }
+    else {
+        int originX = 0, originY = 0, width = 0, height = 0;
+        frameContext.getViewportDimensions(originX, originY, width, height);
+
+        const MMatrix viewInverse =
+            frameContext.getMatrix(MHWRender::MFrameContext::kViewInverseMtx);
+
+        viewChanged = _instanceCuller->SetView(
+            GfMatrix4d(frameContext.getMatrix(MHWRender::MFrameContext::kViewProjMtx).matrix),
+            GfMatrix4d(frameContext.getMatrix(MHWRender::MFrameContext::kProjectionMtx).matrix),
+            GfVec3f(float(viewInverse(3, 0)), float(viewInverse(3, 1)), float(viewInverse(3, 2))),
+            height);
+    }
+
+    if (!viewChanged) {
+        return;
+    }
+
+    MProfilingScope subProfilingScope(HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorD_L1, "Update Instance Culling");
+
+    HdChangeTracker& changeTracker = _renderIndex->GetChangeTracker();
+    for (const SdfPath& id : _instanceCuller->GetRegisteredRprims()) {
+        if (_renderIndex->GetRprim(id)) {
+            changeTracker.MarkRprimDirty(id, HdChangeTracker::DirtyInstanceIndex);
+        }
+        else {
+            _instanceCuller->UnregisterRprim(id);
+        }
+    }
+}
+
 //! \brief  Execute Hydra engine to perform minimal VP2 draw data update based on change tracker.
 void ProxyRenderDelegate::_Execute(const MHWRender::MFrameContext& frameContext)
 {
@@ -614,6 +680,10 @@ void ProxyRenderDelegate::_Execute(const MHWRender::MFrameContext& frameContext)
             _selectionChanged = false;
         }
 
+        // The selection pass may use a pick frustum, culling is only updated
+        // for the view of regular draw.
+        _UpdateInstanceCulling(frameContext);
+
         const unsigned int displayStyle = frameContext.getDisplayStyle();
 
         // Query the wireframe color assigned to proxy shape.
@@ -653,6 +723,14 @@ void ProxyRenderDelegate::_Execute(const MHWRender::MFrameContext& frameContext)
     }
 
     _engine.Execute(_renderIndex.get(), &_dummyTasks);
+
+    if (!inSelectionPass && _instanceCuller->IsEnabled()) {
+        TF_DEBUG(HDVP2_DEBUG_INSTANCE_CULLING).Msg("Instance culling of %s: "
+            "%zu visible instances, %zu culled instances\n",
+            _proxyShapeData->ProxyDagPath().fullPathName().asChar(),
+            _instanceCuller->GetNumVisibleInstances(),
+            _instanceCuller->GetNumCulledInstances());
+    }
 }
 
 //! \brief  Main update entry from subscene override.
@@ -729,15 +807,16 @@ bool ProxyRenderDelegate::getInstancedSelectionPath(
     // selection hit is from one regular render item, but the Rprim can be either plain or single
     // instance, because we don't use instanced draw for single instance render items in order to
     // improve draw performance in Maya 2020 and before.
+    // If instances of the render item have been culled, draw instances are remapped to the USD
+    // instance IDs they were built from.
     const int drawInstID = intersection.instanceID();
+    const int usdInstID = _GetUsdInstanceIndex(renderItemName, drawInstID > 0 ? drawInstID - 1 : 0);
 
 #if defined(USD_IMAGING_API_VERSION) && USD_IMAGING_API_VERSION >= 13
-    const int usdInstID = drawInstID > 0 ? drawInstID - 1 : 0;
     SdfPath usdPath = _sceneDelegate->GetScenePrimPath(rprimId, usdInstID);
 #else
     SdfPath indexPath;
     if (drawInstID > 0) {
-        const int usdInstID = drawInstID - 1;
         indexPath = _sceneDelegate->GetPathForInstanceIndex(rprimId, usdInstID, nullptr);
     }
     else {
@@ -750,7 +829,7 @@ bool ProxyRenderDelegate::getInstancedSelectionPath(
     // instance Rprim and indexPath is actually its instancer Rprim id. In this case we should
     // call GetPathForInstanceIndex() using 0 as the instance index.
     if (!usdPath.IsPrimPath()) {
-        indexPath = _sceneDelegate->GetPathForInstanceIndex(rprimId, 0, nullptr);
+        indexPath = _sceneDelegate->GetPathForInstanceIndex(rprimId, usdInstID, nullptr);
         usdPath = _sceneDelegate->ConvertIndexPathToCachePath(indexPath);
     }
 #endif
@@ -1093,6 +1172,30 @@ bool ProxyRenderDelegate::DrawRenderTag(const TfToken& renderTag) const
     }
 }
 
+//! \brief  Returns the instance culler shared by all Rprims of the proxy shape.
+HdVP2InstanceCuller& ProxyRenderDelegate::GetInstanceCuller()
+{
+    return *_instanceCuller;
+}
+
+/*! \brief  Record the USD instance index of each instance drawn by a render item.
+
+    An empty array means instances are not culled and draw instance indices
+    match USD instance indices. Call from main thread only.
+*/
+void ProxyRenderDelegate::UpdateInstanceIndices(
+    const MString& renderItemName,
+    const std::vector<unsigned int>& instanceIndices)
+{
+    _instanceCuller->SetInstanceIndices(renderItemName.asChar(), instanceIndices);
+}
+
+//! \brief  Map the index of a drawn instance to the index of the USD instance.
+int ProxyRenderDelegate::_GetUsdInstanceIndex(const std::string& renderItemName, int drawInstanceIndex) const
+{
+    return _instanceCuller->GetUsdInstanceIndex(renderItemName, drawInstanceIndex);
+}
+
 // ProxyShapeData
 ProxyRenderDelegate::ProxyShapeData::ProxyShapeData(const MayaUsdProxyShapeBase* proxyShape, const MDagPath& proxyDagPath)
     : _proxyShape(proxyShape)
@@ -17,6 +17,9 @@
 #define PROXY_RENDER_DELEGATE
 
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <maya/MDagPath.h>
 #include <maya/MDrawContext.h>
@@ -64,6 +67,7 @@ class HdRprimCollection;
 class UsdImagingDelegate;
 class MayaUsdProxyShapeBase;
 class HdxTaskController;
+class HdVP2InstanceCuller;
 
 /*! \brief  Enumerations for selection status
 */
@@ -144,6 +148,12 @@ public:
     MAYAUSD_CORE_PUBLIC
     bool DrawRenderTag(const TfToken& renderTag) const;
 
+    MAYAUSD_CORE_PUBLIC
+    HdVP2InstanceCuller& GetInstanceCuller();
+
+    MAYAUSD_CORE_PUBLIC
+    void UpdateInstanceIndices(const MString& renderItemName, const std::vector<unsigned int>& instanceIndices);
+
 private:
     ProxyRenderDelegate(const ProxyRenderDelegate&) = delete;
     ProxyRenderDelegate& operator=(const ProxyRenderDelegate&) = delete;
@@ -159,6 +169,8 @@ private:
     void _PopulateSelection();
     void _UpdateSelectionStates();
     void _UpdateRenderTags();
+    void _UpdateInstanceCulling(const MHWRender::MFrameContext& frameContext);
+    int _GetUsdInstanceIndex(const std::string& renderItemName, int drawInstanceIndex) const;
     void _ClearRenderDelegate();
     SdfPathVector _GetFilteredRprims(HdRprimCollection const& collection, TfTokenVector const& renderTags);
 
@@ -224,6 +236,9 @@ private:
     HdSelectionSharedPtr _leadSelection;                             //!< A collection of Rprims being lead selection
     HdSelectionSharedPtr _activeSelection;                           //!< A collection of Rprims being active selection
 
+    //! Per-instance culling of instanced Rprims
+    std::unique_ptr<HdVP2InstanceCuller> _instanceCuller;
+
 #if defined(WANT_UFE_BUILD)
     //! Observer to listen to UFE changes
     Ufe::Observer::Ptr  _observer;
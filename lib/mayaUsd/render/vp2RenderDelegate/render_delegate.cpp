@@ -38,6 +38,7 @@
 #include "instancer.h"
 #include "material.h"
 #include "mesh.h"
+#include "shaderGraphCache.h"
 #include "render_pass.h"
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -299,6 +300,29 @@ namespace
 
     MShaderCache sShaderCache;  //!< Global shader cache to minimize the number of unique shaders.
 
+    /*! \brief  Clones and releases shader instances for the shader graph cache.
+    */
+    struct MShaderInstanceTraits
+    {
+        static MHWRender::MShaderInstance* Clone(const MHWRender::MShaderInstance& shader)
+        {
+            return shader.clone();
+        }
+
+        static void Release(MHWRender::MShaderInstance* shader)
+        {
+            MHWRender::MRenderer* renderer = MHWRender::MRenderer::theRenderer();
+            const MHWRender::MShaderManager* shaderMgr =
+                renderer ? renderer->getShaderManager() : nullptr;
+            if (TF_VERIFY(shaderMgr)) {
+                shaderMgr->releaseShader(shader);
+            }
+        }
+    };
+
+    //! Prototype shaders of material networks, keyed on network topology.
+    HdVP2ShaderGraphCache<MHWRender::MShaderInstance, MShaderInstanceTraits> sShaderGraphCache;
+
     /*! \brief  Sampler state desc hash helper class, used by sampler state cache.
     */
     struct MSamplerStateDescHash
@@ -419,6 +443,8 @@ HdVP2RenderDelegate::~HdVP2RenderDelegate() {
             delete sSharedBBoxGeom;
             sSharedBBoxGeom = nullptr;
         }
+
+        sShaderGraphCache.Clear();
     }
 }
 
@@ -771,6 +797,26 @@ MHWRender::MShaderInstance* HdVP2RenderDelegate::Get3dFatPointShader() const
     return sShaderCache.Get3dFatPointShader();
 }
 
+/*! \brief  Returns a clone of the shader cached for the shader graph key, or
+            nullptr if no shader was cached for it. The caller owns the clone.
+
+    Cloning skips building the fragment graph, and the clones share the
+    compiled effect of the prototype.
+*/
+MHWRender::MShaderInstance* HdVP2RenderDelegate::AcquireShaderForGraph(
+    const std::string& key) const
+{
+    return sShaderGraphCache.Acquire(key);
+}
+
+/*! \brief  Caches a clone of the shader built for the shader graph key.
+*/
+void HdVP2RenderDelegate::AddShaderForGraph(
+    const std::string& key, const MHWRender::MShaderInstance& shader) const
+{
+    sShaderGraphCache.Add(key, shader);
+}
+
 /*! \brief  Returns a sampler state as specified by the description.
 */
 const MHWRender::MSamplerState* HdVP2RenderDelegate::GetSamplerState(
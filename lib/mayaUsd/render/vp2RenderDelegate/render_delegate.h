@@ -17,6 +17,7 @@
 #define HD_VP2_RENDER_DELEGATE
 
 #include <mutex>
+#include <string>
 #include <atomic>
 
 #include <maya/MString.h>
@@ -114,6 +115,9 @@ public:
     MHWRender::MShaderInstance* GetBasisCurvesLinearFallbackShader(const MColor& color) const;
     MHWRender::MShaderInstance* GetBasisCurvesCubicFallbackShader(const MColor& color) const;
 
+    MHWRender::MShaderInstance* AcquireShaderForGraph(const std::string& key) const;
+    void AddShaderForGraph(const std::string& key, const MHWRender::MShaderInstance& shader) const;
+
     const MHWRender::MSamplerState* GetSamplerState(
         const MHWRender::MSamplerStateDesc& desc) const;
 
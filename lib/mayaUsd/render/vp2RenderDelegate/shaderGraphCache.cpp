@@ -0,0 +1,102 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "shaderGraphCache.h"
+
+#include <pxr/base/tf/staticTokens.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/usd/sdf/path.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+    TF_DEFINE_PRIVATE_TOKENS(
+        _tokens,
+
+        (varname)
+    );
+
+    //! Separator of the key fields, can't appear in tokens nor in parameter values.
+    constexpr char _kSeparator = '\x1f';
+
+    using _NodeIndices = std::unordered_map<SdfPath, size_t, SdfPath::Hash>;
+
+    //! Appends the index of the node at path, or its name if it isn't a node
+    //! of the network.
+    void _AppendNodeRef(
+        std::string& key,
+        const _NodeIndices& nodeIndices,
+        const SdfPath& path)
+    {
+        auto it = nodeIndices.find(path);
+        if (it != nodeIndices.end()) {
+            key += std::to_string(it->second);
+        }
+        else {
+            key += '-';
+            key += path.GetName();
+        }
+        key += _kSeparator;
+    }
+
+} // namespace
+
+/*! \brief  Returns the key of the fragment graph built for a material network.
+
+    Networks with the same key give the same fragment graph and only differ
+    by parameter values. The key is made of, in order:
+    - the identifier and name of every node, since fragment parameters are
+      renamed after the nodes,
+    - the varname parameter of the nodes which have one, since primvar
+      readers rename parameters after it,
+    - every relationship, with nodes referenced by index.
+*/
+std::string HdVP2GetShaderGraphKey(const HdMaterialNetwork& network)
+{
+    std::string key;
+    _NodeIndices nodeIndices;
+
+    for (const HdMaterialNode& node : network.nodes) {
+        nodeIndices.emplace(node.path, nodeIndices.size());
+
+        key += node.identifier.GetString();
+        key += _kSeparator;
+        key += node.path.GetName();
+        key += _kSeparator;
+
+        auto it = node.parameters.find(_tokens->varname);
+        if (it != node.parameters.end()) {
+            key += TfStringify(it->second);
+        }
+        key += _kSeparator;
+    }
+
+    key += _kSeparator;
+
+    for (const HdMaterialRelationship& rel : network.relationships) {
+        _AppendNodeRef(key, nodeIndices, rel.inputId);
+        key += rel.inputName.GetString();
+        key += _kSeparator;
+        _AppendNodeRef(key, nodeIndices, rel.outputId);
+        key += rel.outputName.GetString();
+        key += _kSeparator;
+    }
+
+    return key;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,113 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_SHADER_GRAPH_CACHE
+#define HD_VP2_SHADER_GRAPH_CACHE
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <pxr/pxr.h>
+#include <pxr/imaging/hd/material.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Returns a key identifying the shader graph built for network.
+
+    Two networks get the same key when they have the same nodes, with the same
+    names and primvar reader varnames, and the same connections. Other
+    parameter values are ignored, they are set on the shader instance.
+*/
+std::string HdVP2GetShaderGraphKey(const HdMaterialNetwork& network);
+
+/*! \brief  Cache of shader instances keyed on the topology of the material
+            network they were built from.
+    \class  HdVP2ShaderGraphCache
+
+    Building the fragment graph of a material network is expensive, and many
+    materials of a scene often share the same network topology, only with
+    different parameter values. The cache keeps one prototype shader per
+    topology key, see HdVP2GetShaderGraphKey(), and hands out clones of it.
+
+    The shader type and how to clone and release shaders are template
+    parameters so that the cache can be used without a renderer. Traits must
+    provide static Clone(const ShaderT&) returning a new ShaderT* owned by the
+    caller, and static Release(ShaderT*).
+
+    Thread-safe.
+*/
+template <typename ShaderT, typename TraitsT>
+class HdVP2ShaderGraphCache final
+{
+public:
+    HdVP2ShaderGraphCache() = default;
+    HdVP2ShaderGraphCache(const HdVP2ShaderGraphCache&) = delete;
+    HdVP2ShaderGraphCache& operator=(const HdVP2ShaderGraphCache&) = delete;
+
+    //! Prototypes aren't released on destruction, the renderer may be gone
+    //! already. Call Clear() while it is alive.
+    ~HdVP2ShaderGraphCache() = default;
+
+    /*! \brief  Returns a clone of the prototype for key, owned by the caller,
+                or nullptr if there is no prototype for key.
+    */
+    ShaderT* Acquire(const std::string& key) const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _prototypes.find(key);
+        return (it != _prototypes.end()) ? TraitsT::Clone(*it->second) : nullptr;
+    }
+
+    /*! \brief  Stores a clone of shader as the prototype for key, unless
+                there is one already.
+    */
+    void Add(const std::string& key, const ShaderT& shader)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_prototypes.find(key) != _prototypes.end()) {
+            return;
+        }
+
+        if (ShaderT* prototype = TraitsT::Clone(shader)) {
+            _prototypes.emplace(key, prototype);
+        }
+    }
+
+    //! Releases all prototypes.
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (auto& entry : _prototypes) {
+            TraitsT::Release(entry.second);
+        }
+        _prototypes.clear();
+    }
+
+    //! Number of prototypes.
+    size_t Size() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _prototypes.size();
+    }
+
+private:
+    std::unordered_map<std::string, ShaderT*> _prototypes;  //!< Prototype shader per topology key
+    mutable std::mutex                        _mutex;       //!< Protects _prototypes
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
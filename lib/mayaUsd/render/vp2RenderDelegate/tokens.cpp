@@ -18,5 +18,6 @@
 PXR_NAMESPACE_OPEN_SCOPE
 
 TF_DEFINE_PUBLIC_TOKENS(HdVP2ReprTokens, HDVP2_REPR_TOKENS);
+TF_DEFINE_PUBLIC_TOKENS(HdVP2PerfTokens, HDVP2_PERF_TOKENS);
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -28,6 +28,12 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 TF_DECLARE_PUBLIC_TOKENS(HdVP2ReprTokens, , HDVP2_REPR_TOKENS);
 
+//! Perf counters, see HdPerfLog.
+#define HDVP2_PERF_TOKENS                          \
+    (vertexBufferUploadBytes)
+
+TF_DECLARE_PUBLIC_TOKENS(HdVP2PerfTokens, , HDVP2_PERF_TOKENS);
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
 #endif // HD_VP2_TOKENS_H
@@ -0,0 +1,238 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "UsdNamingService.h"
+
+#include "private/Utils.h"
+
+MAYAUSD_NS_DEF {
+namespace ufe {
+
+//------------------------------------------------------------------------------
+// UsdNamingService::SuffixSet
+//------------------------------------------------------------------------------
+
+std::string UsdNamingService::SuffixSet::findFree(const std::string& suffix)
+{
+	std::string freeSuffix = suffix;
+	auto it = next.find(freeSuffix);
+	while (it != next.end())
+	{
+		freeSuffix = it->second;
+		it = next.find(freeSuffix);
+	}
+
+	// Compress the run, so that the next search starting in it is direct.
+	it = next.find(suffix);
+	while (it != next.end() && it->second != freeSuffix)
+	{
+		const std::string following = it->second;
+		it->second = freeSuffix;
+		it = next.find(following);
+	}
+	return freeSuffix;
+}
+
+void UsdNamingService::SuffixSet::use(const std::string& suffix)
+{
+	next[suffix] = incrementNumericalSuffix(suffix);
+}
+
+//------------------------------------------------------------------------------
+// UsdNamingService::Siblings
+//------------------------------------------------------------------------------
+
+void UsdNamingService::Siblings::add(const std::string& name)
+{
+	names.insert(TfToken(name));
+
+	// Only suffixes generated by unique() can collide, e.g. "cube007" never
+	// prevents "cube7" from being used.
+	std::string base;
+	std::string suffix;
+	if (splitNumericalSuffix(name, base, suffix) && base + suffix == name)
+		suffixes[base].use(suffix);
+}
+
+std::string UsdNamingService::Siblings::unique(const std::string& name)
+{
+	if (names.count(TfToken(name)) == 0)
+		return name;
+
+	// Same naming scheme as uniqueName(): increment the numerical suffix of
+	// the name, or append "1" to it.
+	std::string base{name};
+	std::string suffix{"1"};
+	if (splitNumericalSuffix(name, base, suffix))
+		suffix = incrementNumericalSuffix(suffix);
+
+	// The suffix set only knows about the names added with that base, so
+	// still check the candidate against all the names until it is free.
+	SuffixSet& suffixSet = suffixes[base];
+	suffix = suffixSet.findFree(suffix);
+	while (names.count(TfToken(base + suffix)) > 0)
+	{
+		suffixSet.use(suffix);
+		suffix = suffixSet.findFree(suffix);
+	}
+	return base + suffix;
+}
+
+//------------------------------------------------------------------------------
+// UsdNamingService
+//------------------------------------------------------------------------------
+
+/*static*/
+UsdNamingService& UsdNamingService::instance()
+{
+	static UsdNamingService namingService;
+	return namingService;
+}
+
+UsdNamingService::UsdNamingService()
+{
+}
+
+UsdNamingService::~UsdNamingService()
+{
+}
+
+void UsdNamingService::clear()
+{
+	for (auto& stageCache : fStages)
+		TfNotice::Revoke(stageCache.second.listener);
+	fStages.clear();
+}
+
+UsdNamingService::Siblings& UsdNamingService::siblings(const UsdPrim& parent)
+{
+	UsdStageWeakPtr stage = parent.GetStage();
+	auto stageIt = fStages.find(stage);
+	if (stageIt == fStages.end())
+	{
+		// Drop the caches of stages which have been destroyed since.
+		for (auto it = fStages.begin(); it != fStages.end(); )
+		{
+			if (it->first.IsExpired())
+			{
+				TfNotice::Revoke(it->second.listener);
+				it = fStages.erase(it);
+			}
+			else
+				++it;
+		}
+
+		stageIt = fStages.insert(std::make_pair(stage, StageCache())).first;
+		TfWeakPtr<UsdNamingService> me(this);
+		stageIt->second.listener = TfNotice::Register(me, &UsdNamingService::stageChanged, stage);
+	}
+
+	ParentMap& parents = stageIt->second.parents;
+	auto parentIt = parents.find(parent.GetPath());
+	if (parentIt != parents.end())
+		return parentIt->second;
+
+	Siblings& siblings = parents[parent.GetPath()];
+
+	// The prim GetChildren method used the UsdPrimDefaultPredicate which includes
+	// active prims. We also need the inactive ones.
+	//
+	// const Usd_PrimFlagsConjunction UsdPrimDefaultPredicate =
+	//			UsdPrimIsActive && UsdPrimIsDefined &&
+	//			UsdPrimIsLoaded && !UsdPrimIsAbstract;
+	// Note: removed 'UsdPrimIsLoaded' from the predicate. When it is present the
+	//		 filter doesn't properly return the inactive prims. UsdView doesn't
+	//		 use loaded either in _computeDisplayPredicate().
+	//
+	// Note: our UsdHierarchy uses instance proxies, so we also use them here.
+	for (auto child : parent.GetFilteredChildren(UsdTraverseInstanceProxies(UsdPrimIsDefined && !UsdPrimIsAbstract)))
+	{
+		siblings.add(child.GetName());
+	}
+
+	// The children of an instance or of an instance proxy are those of its
+	// master, which is resynced instead of the parent when they change.
+	if (parent.IsInstance())
+		siblings.masterPath = parent.GetMaster().GetPath();
+	else if (parent.IsInstanceProxy())
+		siblings.masterPath = parent.GetPrimInMaster().GetPath();
+
+	return siblings;
+}
+
+std::string UsdNamingService::uniqueChildName(const UsdPrim& parent, const std::string& name)
+{
+	if (!parent.IsValid()) return std::string();
+
+	return siblings(parent).unique(name);
+}
+
+std::vector<std::string> UsdNamingService::uniqueChildNames(
+	const UsdPrim& parent, const std::vector<std::string>& names)
+{
+	std::vector<std::string> childNames;
+	if (!parent.IsValid()) return childNames;
+
+	// Names handed out are only used if the caller authors the children,
+	// which is notified and invalidates the cache.  Reserve them in a copy
+	// instead of the cache.
+	Siblings reserved = siblings(parent);
+
+	childNames.reserve(names.size());
+	for (const auto& name : names)
+	{
+		childNames.push_back(reserved.unique(name));
+		reserved.add(childNames.back());
+	}
+	return childNames;
+}
+
+void UsdNamingService::stageChanged(UsdNotice::ObjectsChanged const& notice, UsdStageWeakPtr const& sender)
+{
+	auto stageIt = fStages.find(sender);
+	if (stageIt == fStages.end())
+		return;
+
+	ParentMap& parents = stageIt->second.parents;
+	for (const auto& changedPath : notice.GetResyncedPaths())
+	{
+		if (!changedPath.IsAbsoluteRootOrPrimPath())
+			continue;
+
+		if (changedPath.IsAbsoluteRootPath())
+		{
+			parents.clear();
+			return;
+		}
+
+		// The children of the changed prim's parent changed, and resyncs
+		// invalidate the entire subtree of the changed prim, including the
+		// instances whose master is under it or has changed children.
+		parents.erase(changedPath.GetParentPath());
+		for (auto it = parents.begin(); it != parents.end(); )
+		{
+			const SdfPath& masterPath = it->second.masterPath;
+			if (it->first.HasPrefix(changedPath)
+				|| (!masterPath.IsEmpty()
+					&& (changedPath.HasPrefix(masterPath) || masterPath.HasPrefix(changedPath))))
+				it = parents.erase(it);
+			else
+				++it;
+		}
+	}
+}
+
+} // namespace ufe
+} // namespace MayaUsd
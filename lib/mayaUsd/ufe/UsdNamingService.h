@@ -0,0 +1,121 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <pxr/base/tf/hash.h>
+#include <pxr/base/tf/hashmap.h>
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <mayaUsd/base/api.h>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+MAYAUSD_NS_DEF {
+namespace ufe {
+
+//! \brief Unique child names for UFE operations.
+/*!
+	Finding a unique child name requires the names of all the children of the
+	parent.  Enumerating them for every call makes operations on many items
+	under a parent with many children quadratic, e.g. duplicating a thousand
+	prims.  This service caches the sibling names of each parent it is asked
+	about, along with the numerical suffixes already in use for each base
+	name, so that the next free suffix is found without probing.
+
+	The cache of a stage is invalidated by the stage's ObjectsChanged notices,
+	for the parents of the resynced paths.  The children of an instance, and
+	of its instance proxies, are those of its master: their cache is also
+	invalidated by any resync under the master.  Must be used from the main
+	thread.
+ */
+class MAYAUSD_CORE_PUBLIC UsdNamingService : public TfWeakBase
+{
+public:
+	//! Get the naming service.
+	static UsdNamingService& instance();
+
+	// Delete the copy/move constructors assignment operators.
+	UsdNamingService(const UsdNamingService&) = delete;
+	UsdNamingService& operator=(const UsdNamingService&) = delete;
+	UsdNamingService(UsdNamingService&&) = delete;
+	UsdNamingService& operator=(UsdNamingService&&) = delete;
+
+	//! Return name if no child of parent has it, otherwise a unique name made
+	//! by incrementing the numerical suffix of name, see uniqueName().
+	std::string uniqueChildName(const UsdPrim& parent, const std::string& name);
+
+	//! Return unique child names for many new children of parent at once.
+	//! The returned names are also unique among themselves.
+	std::vector<std::string> uniqueChildNames(const UsdPrim& parent, const std::vector<std::string>& names);
+
+	//! Drop the cached names of all stages.
+	void clear();
+
+private:
+	UsdNamingService();
+	~UsdNamingService();
+
+	// Next free numerical suffix for a base name.  Suffixes in use point to
+	// the next candidate, so that a run of used suffixes is skipped at once.
+	// Suffixes are decimal strings, so that they can have any number of
+	// digits.
+	struct SuffixSet
+	{
+		std::unordered_map<std::string, std::string> next;
+
+		std::string findFree(const std::string& suffix);
+		void        use(const std::string& suffix);
+	};
+
+	struct Siblings
+	{
+		TfToken::HashSet                           names;
+		std::unordered_map<std::string, SuffixSet> suffixes;
+		// Path of the master prim the children come from, if any.
+		SdfPath                                    masterPath;
+
+		void        add(const std::string& name);
+		std::string unique(const std::string& name);
+	};
+
+	typedef std::unordered_map<SdfPath, Siblings, SdfPath::Hash> ParentMap;
+
+	struct StageCache
+	{
+		ParentMap       parents;
+		TfNotice::Key   listener;
+	};
+
+	Siblings& siblings(const UsdPrim& parent);
+
+	void stageChanged(UsdNotice::ObjectsChanged const& notice, UsdStageWeakPtr const& sender);
+
+	TfHashMap<UsdStageWeakPtr, StageCache, TfHash> fStages;
+
+}; // UsdNamingService
+
+} // namespace ufe
+} // namespace MayaUsd
@@ -0,0 +1,202 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "UsdTRSBatchUndoableCommand.h"
+
+#include <mayaUsd/ufe/Global.h>
+#include <mayaUsd/ufe/Utils.h>
+#include <mayaUsd/ufe/UsdRotateUndoableCommand.h>
+#include <mayaUsd/ufe/UsdScaleUndoableCommand.h>
+#include <mayaUsd/ufe/UsdTranslateUndoableCommand.h>
+
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/usdGeom/xformCommonAPI.h>
+
+MAYAUSD_NS_DEF {
+namespace ufe {
+
+namespace {
+
+#if UFE_PREVIEW_VERSION_NUM < 2025
+bool setItemValue(UsdTranslateUndoableCommand& cmd, double x, double y, double z)
+{
+	return cmd.translate(x, y, z);
+}
+
+bool setItemValue(UsdRotateUndoableCommand& cmd, double x, double y, double z)
+{
+	return cmd.rotate(x, y, z);
+}
+
+bool setItemValue(UsdScaleUndoableCommand& cmd, double x, double y, double z)
+{
+	return cmd.scale(x, y, z);
+}
+#endif
+
+// The per-item commands set their value with translate(), rotate() or scale()
+// before UFE 2025, and set() since.
+template<class Cmd>
+std::function<bool(double, double, double)> itemSetter(const std::shared_ptr<Cmd>& cmd)
+{
+	return [cmd](double x, double y, double z) {
+#if UFE_PREVIEW_VERSION_NUM >= 2025
+		return cmd->set(x, y, z);
+#else
+		return setItemValue(*cmd, x, y, z);
+#endif
+	};
+}
+
+} // namespace
+
+UsdTRSBatchUndoableCommand::UsdTRSBatchUndoableCommand(Operation operation)
+	: Ufe::UndoableCommand()
+	, fOperation(operation)
+{
+}
+
+UsdTRSBatchUndoableCommand::~UsdTRSBatchUndoableCommand()
+{
+}
+
+/*static*/
+UsdTRSBatchUndoableCommand::Ptr UsdTRSBatchUndoableCommand::create(
+	const std::vector<Ufe::Path>& paths, Operation operation)
+{
+	auto cmd = std::make_shared<UsdTRSBatchUndoableCommand>(operation);
+	cmd->fItems.reserve(paths.size());
+	for (const auto& path : paths)
+		cmd->append(path);
+	return cmd;
+}
+
+void UsdTRSBatchUndoableCommand::append(const Ufe::Path& path)
+{
+	if (path.runTimeId() != getUsdRunTimeId())
+		return;
+
+	UsdPrim prim = ufePathToPrim(path);
+	if (!prim)
+	{
+		TF_WARN("Cannot transform %s: invalid prim.", path.string().c_str());
+		return;
+	}
+
+	GfVec3d translation;
+	GfVec3f rotation, scale, pivot;
+	UsdGeomXformCommonAPI::RotationOrder rotOrder;
+	UsdGeomXformCommonAPI(prim).GetXformVectors(
+		&translation, &rotation, &scale, &pivot, &rotOrder, getTime(path));
+
+	Item item;
+	switch (fOperation)
+	{
+	case kTranslate:
+	{
+		item.prevValue = translation;
+		auto cmd = UsdTranslateUndoableCommand::create(
+			path, item.prevValue[0], item.prevValue[1], item.prevValue[2]);
+		item.cmd = cmd;
+		item.set = itemSetter(cmd);
+		break;
+	}
+	case kRotate:
+	{
+		item.prevValue = GfVec3d(rotation);
+		auto cmd = UsdRotateUndoableCommand::create(
+			path, item.prevValue[0], item.prevValue[1], item.prevValue[2]);
+		item.cmd = cmd;
+		item.set = itemSetter(cmd);
+		break;
+	}
+	case kScale:
+	{
+		item.prevValue = GfVec3d(scale);
+		auto cmd = UsdScaleUndoableCommand::create(
+			path, item.prevValue[0], item.prevValue[1], item.prevValue[2]);
+		item.cmd = cmd;
+		item.set = itemSetter(cmd);
+		break;
+	}
+	}
+
+	// Resolve the xform op now, outside of any change block: the common
+	// transform API may have to author new xform ops, which the stage must
+	// recompose before they can be set again.
+	if (!item.set(item.prevValue[0], item.prevValue[1], item.prevValue[2]))
+	{
+		TF_WARN("Cannot transform %s.", path.string().c_str());
+		return;
+	}
+
+	fItems.push_back(std::move(item));
+}
+
+bool UsdTRSBatchUndoableCommand::set(const std::vector<GfVec3d>& values)
+{
+	if (values.size() != fItems.size())
+	{
+		TF_CODING_ERROR("Expected %zu values, got %zu.", fItems.size(), values.size());
+		return false;
+	}
+
+	SdfChangeBlock changeBlock;
+	bool ok = true;
+	for (size_t i = 0; i < fItems.size(); ++i)
+	{
+		const GfVec3d& value = values[i];
+		ok = fItems[i].set(value[0], value[1], value[2]) && ok;
+	}
+	return ok;
+}
+
+bool UsdTRSBatchUndoableCommand::setRelative(double x, double y, double z)
+{
+	const GfVec3d delta(x, y, z);
+	std::vector<GfVec3d> values;
+	values.reserve(fItems.size());
+	for (const auto& item : fItems)
+	{
+		if (fOperation == kScale)
+			values.push_back(GfCompMult(item.prevValue, delta));
+		else
+			values.push_back(item.prevValue + delta);
+	}
+	return set(values);
+}
+
+//------------------------------------------------------------------------------
+// Ufe::UndoableCommand overrides
+//------------------------------------------------------------------------------
+
+void UsdTRSBatchUndoableCommand::undo()
+{
+	SdfChangeBlock changeBlock;
+	for (auto it = fItems.rbegin(); it != fItems.rend(); ++it)
+		it->cmd->undo();
+}
+
+void UsdTRSBatchUndoableCommand::redo()
+{
+	SdfChangeBlock changeBlock;
+	for (auto& item : fItems)
+		item.cmd->redo();
+}
+
+} // namespace ufe
+} // namespace MayaUsd
@@ -0,0 +1,101 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include <ufe/path.h>
+#include <ufe/undoableCommand.h>
+
+#include <pxr/base/gf/vec3d.h>
+
+#include <mayaUsd/base/api.h>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+MAYAUSD_NS_DEF {
+namespace ufe {
+
+//! \brief Translate, rotate or scale of many prims as a single undoable command.
+/*!
+	The command wraps the per-item translate, rotate or scale command of each
+	prim. These are created and their xform op resolved through the common
+	transform API when the batch is created, one prim at a time, since
+	authoring new xform ops requires the stage to recompose.
+
+	Subsequent calls to set() or setRelative(), e.g. for every drag update of
+	an interactive manipulation, execute all per-item commands inside a single
+	SdfChangeBlock. The stage then sends a single ObjectsChanged notice and
+	the viewport gets a single update per call. Undo and redo of the per-item
+	commands are batched the same way, so the whole selection is a single
+	undo item.
+ */
+class MAYAUSD_CORE_PUBLIC UsdTRSBatchUndoableCommand : public Ufe::UndoableCommand
+{
+public:
+	typedef std::shared_ptr<UsdTRSBatchUndoableCommand> Ptr;
+
+	enum Operation { kTranslate, kRotate, kScale };
+
+	UsdTRSBatchUndoableCommand(Operation operation);
+	~UsdTRSBatchUndoableCommand() override;
+
+	// Delete the copy/move constructors assignment operators.
+	UsdTRSBatchUndoableCommand(const UsdTRSBatchUndoableCommand&) = delete;
+	UsdTRSBatchUndoableCommand& operator=(const UsdTRSBatchUndoableCommand&) = delete;
+	UsdTRSBatchUndoableCommand(UsdTRSBatchUndoableCommand&&) = delete;
+	UsdTRSBatchUndoableCommand& operator=(UsdTRSBatchUndoableCommand&&) = delete;
+
+	//! Create a UsdTRSBatchUndoableCommand for the USD prims of the given
+	//! paths. Paths to non-USD items or invalid prims are ignored. The command
+	//! is not executed.
+	static UsdTRSBatchUndoableCommand::Ptr create(
+		const std::vector<Ufe::Path>& paths, Operation operation);
+
+	//! Number of prims the command applies to.
+	size_t size() const { return fItems.size(); }
+
+	//! Set absolute values (rotations in degrees), one per prim in the order
+	//! of the paths the command was created with, and execute the command.
+	bool set(const std::vector<GfVec3d>& values);
+
+	//! Set the values relative to the values prims had before the command:
+	//! translation and rotation are offset, scale is multiplied. Executes the
+	//! command.
+	bool setRelative(double x, double y, double z);
+
+	// Ufe::UndoableCommand overrides
+	void undo() override;
+	void redo() override;
+
+private:
+	struct Item
+	{
+		Ufe::UndoableCommand::Ptr                    cmd;
+		std::function<bool(double, double, double)> set;
+		GfVec3d                                      prevValue;
+	};
+
+	void append(const Ufe::Path& path);
+
+	Operation         fOperation;
+	std::vector<Item> fItems;
+
+}; // UsdTRSBatchUndoableCommand
+
+} // namespace ufe
+} // namespace MayaUsd
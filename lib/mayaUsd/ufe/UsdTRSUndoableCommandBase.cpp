@@ -95,6 +95,7 @@ void UsdTRSUndoableCommandBase<V>::undoImp()
     updateItem();
     #endif
 
+    fAttribute = UsdAttribute();
     attribute().Set(fPrevValue);
     // Todo : We would want to remove the xformOp
     // (SD-06/07/2018) Haven't found a clean way to do it - would need to investigate
@@ -113,6 +114,8 @@ void UsdTRSUndoableCommandBase<V>::redoImp()
     updateItem();
     #endif
 
+    fAttribute = UsdAttribute();
+
     // We must go through conversion to the common transform API by calling
     // perform(), otherwise we get "Empty typeName" USD assertions for rotate
     // and scale.  Once that is done, we can simply set the attribute directly.
@@ -131,6 +134,7 @@ void UsdTRSUndoableCommandBase<V>::checkNotification(const N* notification)
 {
     if (notification->previousPath() == path()) {
         fItem = std::dynamic_pointer_cast<UsdSceneItem>(notification->item());
+        fAttribute = UsdAttribute();
     }
 }
 #endif
@@ -139,8 +143,23 @@ template<class V>
 void UsdTRSUndoableCommandBase<V>::perform(double x, double y, double z)
 {
     fNewValue = V(x, y, z);
+
+    // Once the xform op has been resolved, e.g. during interactive
+    // manipulation, set the cached attribute directly. Fall back to the
+    // common transform API if the attribute is stale.
+    if (fDoneOnce && fAttribute.IsValid() && fAttribute.Set(fNewValue)) {
+        return;
+    }
+
     performImp(x, y, z);
     fDoneOnce = true;
+
+    // Only cache an attribute holding the command's value type, e.g. a
+    // float3 translate authored outside of Maya still goes through the
+    // common transform API.
+    auto attr = attribute();
+    fAttribute = (attr && attr.GetTypeName().GetType() == TfType::Find<V>()) ?
+        attr : UsdAttribute();
 }
 
 template<class V>
@@ -40,6 +40,8 @@ namespace ufe {
 // - Keep track of the new value, in case it is set repeatedly (e.g. during
 //   interactive command use when manipulating, before the manipulation
 //   ends and the command is committed).
+// - Cache the attribute once the xform op has been resolved, so that
+//   repeated interactive updates only set its value.
 // - Keep track of the scene item, in case its path changes (e.g. when the
 //   prim is renamed or reparented).  A command can be created before it's
 //   used, or the undo / redo stack can cause an item to be renamed or
@@ -116,6 +118,9 @@ private:
     }
 
     mutable UsdSceneItem::Ptr fItem{nullptr};
+    // Attribute resolved by the first perform(), set directly by subsequent
+    // calls so that interactive updates skip the common transform API.
+    UsdAttribute              fAttribute;
     V                         fPrevValue;
     V                         fNewValue;
     bool                      fOpAdded{false};
@@ -23,6 +23,7 @@
 #include <pxr/usd/sdf/copyUtils.h>
 #include <pxr/usd/usd/stage.h>
 
+#include <mayaUsd/ufe/UsdNamingService.h>
 #include <mayaUsd/ufe/Utils.h>
 
 #include <mayaUsdUtils/util.h>
@@ -58,15 +59,10 @@ const SdfPath& UsdUndoDuplicateCommand::usdDstPath() const
 void UsdUndoDuplicateCommand::primInfo(const UsdPrim& srcPrim, SdfPath& usdDstPath, SdfLayerHandle& srcLayer)
 {
 	auto parent = srcPrim.GetParent();
-	TfToken::HashSet childrenNames;
-	for(auto child : parent.GetFilteredChildren(UsdPrimIsDefined && !UsdPrimIsAbstract))
-	{
-		childrenNames.insert(child.GetName());
-	}
 
 	// Find a unique name for the destination.  If the source name already
 	// has a numerical suffix, increment it, otherwise append "1" to it.
-	auto dstName = uniqueName(childrenNames, srcPrim.GetName());
+	auto dstName = UsdNamingService::instance().uniqueChildName(parent, srcPrim.GetName());
 	usdDstPath = parent.GetPath().AppendChild(TfToken(dstName));
 
 	// Iterate over the layer stack, starting at the highest-priority layer.
@@ -0,0 +1,169 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "UsdUndoDuplicateSelectionCommand.h"
+
+#include <map>
+
+#include <ufe/log.h>
+#include <ufe/scene.h>
+#include <ufe/sceneNotification.h>
+
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/copyUtils.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <mayaUsd/ufe/UsdNamingService.h>
+#include <mayaUsd/ufe/Utils.h>
+
+#include <mayaUsdUtils/util.h>
+
+MAYAUSD_NS_DEF {
+namespace ufe {
+
+UsdUndoDuplicateSelectionCommand::UsdUndoDuplicateSelectionCommand(const Ufe::Selection& selection)
+	: Ufe::UndoableCommand()
+{
+	// Group the items by parent, so that the names of the duplicates of a
+	// parent's children are computed at once.
+	std::map<std::pair<UsdStageWeakPtr, SdfPath>, std::vector<UsdPrim>> srcPrimsByParent;
+	std::map<SdfPath, Ufe::Path> ufeSrcPaths;
+	for (const auto& item : selection)
+	{
+		auto usdItem = downcast(item);
+		if (!usdItem)
+			continue;
+
+		const UsdPrim& srcPrim = usdItem->prim();
+		if (!srcPrim.IsValid())
+			continue;
+
+		srcPrimsByParent[std::make_pair(srcPrim.GetStage(), srcPrim.GetParent().GetPath())].push_back(srcPrim);
+		ufeSrcPaths[srcPrim.GetPath()] = usdItem->path();
+	}
+
+	for (const auto& parentPrims : srcPrimsByParent)
+	{
+		const auto& srcPrims = parentPrims.second;
+		const UsdPrim parent = srcPrims.front().GetParent();
+
+		std::vector<std::string> srcNames;
+		srcNames.reserve(srcPrims.size());
+		for (const auto& srcPrim : srcPrims)
+			srcNames.push_back(srcPrim.GetName());
+
+		// If a source name already has a numerical suffix, increment it,
+		// otherwise append "1" to it.
+		const auto dstNames = UsdNamingService::instance().uniqueChildNames(parent, srcNames);
+
+		for (size_t i = 0; i < srcPrims.size(); ++i)
+		{
+			const UsdPrim& srcPrim = srcPrims[i];
+
+			// See UsdUndoDuplicateCommand::primInfo() for the choice of
+			// source layer.
+			SdfLayerHandle layer = MayaUsdUtils::defPrimSpecLayer(srcPrim);
+			if (!layer)
+			{
+				TF_WARN("No prim found at %s", srcPrim.GetPath().GetString().c_str());
+				continue;
+			}
+
+			Item item;
+			item.ufeSrcPath = ufeSrcPaths[srcPrim.GetPath()];
+			item.usdSrcPath = srcPrim.GetPath();
+			item.usdDstPath = parent.GetPath().AppendChild(TfToken(dstNames[i]));
+			item.layer = layer;
+			fItems.push_back(item);
+		}
+	}
+}
+
+UsdUndoDuplicateSelectionCommand::~UsdUndoDuplicateSelectionCommand()
+{
+}
+
+/*static*/
+UsdUndoDuplicateSelectionCommand::Ptr UsdUndoDuplicateSelectionCommand::create(const Ufe::Selection& selection)
+{
+	return std::make_shared<UsdUndoDuplicateSelectionCommand>(selection);
+}
+
+UsdSceneItem::Ptr UsdUndoDuplicateSelectionCommand::duplicatedItem(const Ufe::Path& ufeSrcPath) const
+{
+	for (const auto& item : fItems)
+	{
+		if (item.ufeSrcPath == ufeSrcPath)
+			return createSiblingSceneItem(ufeSrcPath, item.usdDstPath.GetElementString());
+	}
+	return nullptr;
+}
+
+//------------------------------------------------------------------------------
+// UsdUndoDuplicateSelectionCommand overrides
+//------------------------------------------------------------------------------
+
+void UsdUndoDuplicateSelectionCommand::undo()
+{
+	// See UsdUndoDuplicateCommand::undo() for the pre delete notifications.
+	for (const auto& item : fItems)
+	{
+		Ufe::ObjectPreDelete notification(createSiblingSceneItem(
+											item.ufeSrcPath, item.usdDstPath.GetElementString()));
+
+		#ifdef UFE_V2_FEATURES_AVAILABLE
+		Ufe::Scene::instance().notify(notification);
+		#else
+		Ufe::Scene::notifyObjectDelete(notification);
+		#endif
+	}
+
+	// Remove the specs copied by redo() with the Sdf API, which is safe to
+	// use inside a change block, unlike UsdStage::RemovePrim().
+	SdfChangeBlock changeBlock;
+	for (const auto& item : fItems)
+	{
+		if (!item.layer)
+			continue;
+
+		SdfPrimSpecHandle dstSpec = item.layer->GetPrimAtPath(item.usdDstPath);
+		if (!dstSpec)
+			continue;
+
+		SdfPrimSpecHandle parentSpec = dstSpec->GetRealNameParent();
+		if (parentSpec)
+			parentSpec->RemoveNameChild(dstSpec);
+		else
+			item.layer->RemoveRootPrim(dstSpec);
+	}
+}
+
+void UsdUndoDuplicateSelectionCommand::redo()
+{
+	SdfChangeBlock changeBlock;
+	for (const auto& item : fItems)
+	{
+		// We use the source layer as the destination, as does
+		// UsdUndoDuplicateCommand::duplicate().
+		if (!SdfCopySpec(item.layer, item.usdSrcPath, item.layer, item.usdDstPath))
+		{
+			UFE_LOG(std::string("Failed to duplicate ") + item.usdSrcPath.GetString());
+		}
+	}
+}
+
+} // namespace ufe
+} // namespace MayaUsd
@@ -0,0 +1,81 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#pragma once
+
+#include <vector>
+
+#include <ufe/path.h>
+#include <ufe/selection.h>
+#include <ufe/undoableCommand.h>
+
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <mayaUsd/base/api.h>
+#include <mayaUsd/ufe/UsdSceneItem.h>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+MAYAUSD_NS_DEF {
+namespace ufe {
+
+//! \brief Duplicate all the USD items of a selection as a single command.
+/*!
+	Destination names are computed for all items at once by the naming
+	service, and the prim specs are copied inside a single SdfChangeBlock, so
+	that each stage sends a single notice for the whole duplicate.
+ */
+class MAYAUSD_CORE_PUBLIC UsdUndoDuplicateSelectionCommand : public Ufe::UndoableCommand
+{
+public:
+	typedef std::shared_ptr<UsdUndoDuplicateSelectionCommand> Ptr;
+
+	UsdUndoDuplicateSelectionCommand(const Ufe::Selection& selection);
+	~UsdUndoDuplicateSelectionCommand() override;
+
+	// Delete the copy/move constructors assignment operators.
+	UsdUndoDuplicateSelectionCommand(const UsdUndoDuplicateSelectionCommand&) = delete;
+	UsdUndoDuplicateSelectionCommand& operator=(const UsdUndoDuplicateSelectionCommand&) = delete;
+	UsdUndoDuplicateSelectionCommand(UsdUndoDuplicateSelectionCommand&&) = delete;
+	UsdUndoDuplicateSelectionCommand& operator=(UsdUndoDuplicateSelectionCommand&&) = delete;
+
+	//! Create a UsdUndoDuplicateSelectionCommand for the USD items of a
+	//! selection.  Non-USD items are ignored.
+	static UsdUndoDuplicateSelectionCommand::Ptr create(const Ufe::Selection& selection);
+
+	//! Return the duplicate of the item at ufeSrcPath, or nullptr if the item
+	//! was not duplicated.
+	UsdSceneItem::Ptr duplicatedItem(const Ufe::Path& ufeSrcPath) const;
+
+	// UsdUndoDuplicateSelectionCommand overrides
+	void undo() override;
+	void redo() override;
+
+private:
+	struct Item
+	{
+		Ufe::Path       ufeSrcPath;
+		SdfPath         usdSrcPath;
+		SdfPath         usdDstPath;
+		SdfLayerHandle  layer;
+	};
+
+	std::vector<Item> fItems;
+
+}; // UsdUndoDuplicateSelectionCommand
+
+} // namespace ufe
+} // namespace MayaUsd
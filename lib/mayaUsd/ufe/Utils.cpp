@@ -17,7 +17,6 @@
 
 #include <cassert>
 #include <memory>
-#include <regex>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
@@ -32,6 +31,7 @@
 
 #include <mayaUsd/nodes/proxyShapeBase.h>
 #include <mayaUsd/ufe/ProxyShapeHandler.h>
+#include <mayaUsd/ufe/UsdNamingService.h>
 #include <mayaUsd/ufe/UsdStageMap.h>
 #include <mayaUsd/utils/util.h>
 
@@ -110,22 +110,17 @@ UsdSceneItem::Ptr createSiblingSceneItem(const Ufe::Path& ufeSrcPath, const std:
 
 std::string uniqueName(const TfToken::HashSet& existingNames, std::string srcName)
 {
-	// Compiled regular expression to find a numerical suffix to a path component.
-	// It searches for any number of characters followed by a single non-numeric,
-	// then one or more digits at end of string.
-	std::regex re("(.*)([^0-9])([0-9]+)$");
 	std::string base{srcName};
-	int suffix{1};
-	std::smatch match;
-	if (std::regex_match(srcName, match, re))
+	std::string suffix{"1"};
+	if (splitNumericalSuffix(srcName, base, suffix))
 	{
-		base = match[1].str() + match[2].str();
-		suffix = std::stoi(match[3].str()) + 1;
+		suffix = incrementNumericalSuffix(suffix);
 	}
-	std::string dstName = base + std::to_string(suffix);
+	std::string dstName = base + suffix;
 	while (existingNames.count(TfToken(dstName)) > 0)
 	{
-		dstName = base + std::to_string(++suffix);
+		suffix = incrementNumericalSuffix(suffix);
+		dstName = base + suffix;
 	}
 	return dstName;
 }
@@ -134,29 +129,7 @@ std::string uniqueChildName(const UsdPrim& usdParent, const std::string& name)
 {
 	if (!usdParent.IsValid()) return std::string();
 
-	TfToken::HashSet childrenNames;
-
-	// The prim GetChildren method used the UsdPrimDefaultPredicate which includes
-	// active prims. We also need the inactive ones.
-	//
-	// const Usd_PrimFlagsConjunction UsdPrimDefaultPredicate = 
-	//			UsdPrimIsActive && UsdPrimIsDefined && 
-	//			UsdPrimIsLoaded && !UsdPrimIsAbstract;
-	// Note: removed 'UsdPrimIsLoaded' from the predicate. When it is present the
-	//		 filter doesn't properly return the inactive prims. UsdView doesn't
-	//		 use loaded either in _computeDisplayPredicate().
-	//
-	// Note: our UsdHierarchy uses instance proxies, so we also use them here.
-	for (auto child : usdParent.GetFilteredChildren(UsdTraverseInstanceProxies(UsdPrimIsDefined && !UsdPrimIsAbstract)))
-	{
-		childrenNames.insert(child.GetName());
-	}
-	std::string childName{name};
-	if (childrenNames.find(TfToken(childName)) != childrenNames.end())
-	{
-		childName = uniqueName(childrenNames, childName);
-	}
-	return childName;
+	return UsdNamingService::instance().uniqueChildName(usdParent, name);
 }
 
 bool isAGatewayType(const std::string& mayaNodeType)
@@ -15,6 +15,7 @@
 //
 #include "Utils.h"
 
+#include <cctype>
 #include <memory>
 #include <string>
 
@@ -127,6 +128,43 @@ UsdGeomXformCommonAPI convertToCompatibleCommonAPI(const UsdPrim& prim)
     return primXform;
 }
 
+bool splitNumericalSuffix(const std::string& name, std::string& base, std::string& suffix)
+{
+	// Equivalent to matching "(.*)([^0-9])([0-9]+)$", without the cost of
+	// compiling a regular expression on every call.
+	size_t digitsBegin = name.size();
+	while (digitsBegin > 0 && std::isdigit(static_cast<unsigned char>(name[digitsBegin - 1])))
+		--digitsBegin;
+
+	if (digitsBegin == name.size() || digitsBegin == 0)
+		return false;
+
+	// Drop leading zeros, but keep a single "0".
+	size_t numberBegin = digitsBegin;
+	while (numberBegin < name.size() - 1 && name[numberBegin] == '0')
+		++numberBegin;
+
+	base = name.substr(0, digitsBegin);
+	suffix = name.substr(numberBegin);
+	return true;
+}
+
+std::string incrementNumericalSuffix(std::string suffix)
+{
+	// Add one to the decimal string, so that suffixes too long for an
+	// integer don't overflow.
+	for (auto it = suffix.rbegin(); it != suffix.rend(); ++it)
+	{
+		if (*it != '9')
+		{
+			++(*it);
+			return suffix;
+		}
+		*it = '0';
+	}
+	return "1" + suffix;
+}
+
 void applyCommandRestriction(const UsdPrim& prim, const std::string& commandName)
 {
     // return early if prim is the pseudo-root.
@@ -54,6 +54,17 @@ UsdGeomXformCommonAPI convertToCompatibleCommonAPI(const UsdPrim& prim);
 //! Apply restriction rules on the given prim
 void applyCommandRestriction(const UsdPrim& prim, const std::string& commandName);
 
+//! Split a name ending with digits preceded by a non-digit into a base name
+//! and a numerical suffix, e.g. "cube12" into "cube" and "12".  Leading zeros
+//! are dropped from the suffix, e.g. "cube007" gives "7".  The suffix is kept
+//! as a string, so that suffixes of any number of digits are supported.
+//! \return False if the name has no numerical suffix.
+bool splitNumericalSuffix(const std::string& name, std::string& base, std::string& suffix);
+
+//! Increment a numerical suffix returned by splitNumericalSuffix(), e.g. "9"
+//! into "10".
+std::string incrementNumericalSuffix(std::string suffix);
+
 //------------------------------------------------------------------------------
 // Operations: translate, rotate, scale, pivot
 //------------------------------------------------------------------------------
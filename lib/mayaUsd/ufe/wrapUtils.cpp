@@ -15,14 +15,20 @@
 //
 #include <boost/python.hpp>
 
+#include <ufe/hierarchy.h>
 #include <ufe/runTimeMgr.h>
 #include <ufe/rtid.h>
+#include <ufe/selection.h>
 
 #include <pxr/base/tf/stringUtils.h>
 
 #include <mayaUsd/ufe/Global.h>
 #include <mayaUsd/ufe/UsdSceneItem.h>
+#include <mayaUsd/ufe/UsdUndoDuplicateSelectionCommand.h>
 #include <mayaUsd/ufe/Utils.h>
+#ifdef UFE_V2_FEATURES_AVAILABLE
+#include <mayaUsd/ufe/UsdTRSBatchUndoableCommand.h>
+#endif
 
 using namespace MayaUsd;
 using namespace boost::python;
@@ -76,18 +82,12 @@ std::string stagePath(UsdStageWeakPtr stage)
     return ufe::stagePath(stage).string();
 }
 
-UsdPrim ufePathToPrim(const std::string& ufePathString)
+Ufe::Path toUfePath(const std::string& ufePathString)
 {
     // The path string is a list of segment strings separated by ',' comma
     // separator.
     auto segmentStrings = TfStringTokenize(ufePathString, ",");
 
-    // If there's just one segment, it's the Maya Dag path segment, so it can't
-    // have a prim.
-    if (segmentStrings.size() == 1) {
-        return UsdPrim();
-    }
-
     // We have the path string split into segments.  Build up the Ufe::Path one
     // segment at a time.  The path segment separator is the first character
     // of each segment.  We know that USD's separator is '/' and Maya's
@@ -100,9 +100,93 @@ UsdPrim ufePathToPrim(const std::string& ufePathString)
         char sep = segmentString[0];
         path = path + Ufe::PathSegment(segmentString, sepToRtid.at(sep), sep);
     }
+    return path;
+}
+
+UsdPrim ufePathToPrim(const std::string& ufePathString)
+{
+    Ufe::Path path = toUfePath(ufePathString);
+
+    // If there's just one segment, it's the Maya Dag path segment, so it can't
+    // have a prim.
+    if (path.nbSegments() == 1) {
+        return UsdPrim();
+    }
+
     return ufe::ufePathToPrim(path);
 }
 
+ufe::UsdUndoDuplicateSelectionCommand::Ptr createDuplicateSelectionCommand(
+    const boost::python::list& ufePathStrings)
+{
+    Ufe::Selection selection;
+    for (int i = 0; i < len(ufePathStrings); ++i) {
+        auto item = Ufe::Hierarchy::createItem(
+            toUfePath(extract<std::string>(ufePathStrings[i])));
+        if (item) {
+            selection.append(item);
+        }
+    }
+    return ufe::UsdUndoDuplicateSelectionCommand::create(selection);
+}
+
+void wrapDuplicateSelectionCommand()
+{
+    using This = ufe::UsdUndoDuplicateSelectionCommand;
+
+    class_<This, This::Ptr, boost::noncopyable>(
+            "DuplicateSelectionCommand", no_init)
+        .def("__init__", make_constructor(createDuplicateSelectionCommand))
+        .def("undo", &This::undo)
+        .def("redo", &This::redo)
+        ;
+}
+
+#ifdef UFE_V2_FEATURES_AVAILABLE
+ufe::UsdTRSBatchUndoableCommand::Ptr createTRSBatchCommand(
+    const boost::python::list& ufePathStrings,
+    ufe::UsdTRSBatchUndoableCommand::Operation operation)
+{
+    std::vector<Ufe::Path> paths;
+    for (int i = 0; i < len(ufePathStrings); ++i) {
+        paths.push_back(toUfePath(extract<std::string>(ufePathStrings[i])));
+    }
+    return ufe::UsdTRSBatchUndoableCommand::create(paths, operation);
+}
+
+bool setTRSBatchCommandValues(
+    ufe::UsdTRSBatchUndoableCommand& cmd,
+    const boost::python::list& values)
+{
+    std::vector<GfVec3d> vec3dValues;
+    for (int i = 0; i < len(values); ++i) {
+        vec3dValues.push_back(extract<GfVec3d>(values[i]));
+    }
+    return cmd.set(vec3dValues);
+}
+
+void wrapTRSBatchCommand()
+{
+    using This = ufe::UsdTRSBatchUndoableCommand;
+
+    scope s = class_<This, This::Ptr, boost::noncopyable>(
+            "TRSBatchCommand", no_init)
+        .def("__init__", make_constructor(createTRSBatchCommand))
+        .def("size", &This::size)
+        .def("set", setTRSBatchCommandValues)
+        .def("setRelative", &This::setRelative)
+        .def("undo", &This::undo)
+        .def("redo", &This::redo)
+        ;
+
+    enum_<This::Operation>("Operation")
+        .value("Translate", This::kTranslate)
+        .value("Rotate", This::kRotate)
+        .value("Scale", This::kScale)
+        ;
+}
+#endif
+
 void
 wrapUtils()
 {
@@ -123,4 +207,15 @@ wrapUtils()
     def("getStage", getStage);
     def("stagePath", stagePath);
     def("ufePathToPrim", ufePathToPrim);
+
+    // Duplicate many items as a single undoable command, e.g.
+    // DuplicateSelectionCommand([path, ...]).  The command is executed by
+    // redo().
+    wrapDuplicateSelectionCommand();
+
+    #ifdef UFE_V2_FEATURES_AVAILABLE
+        // Translate, rotate or scale many prims as a single undoable command,
+        // e.g. TRSBatchCommand([path, ...], TRSBatchCommand.Operation.Translate).
+        wrapTRSBatchCommand();
+    #endif
 }
@@ -15,13 +15,20 @@
 //
 #include "diagnosticDelegate.h"
 
+#include <algorithm>
+#include <array>
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include <maya/MGlobal.h>
 
 #include <pxr/base/arch/threads.h>
 #include <pxr/base/tf/envSetting.h>
 #include <pxr/base/tf/stackTrace.h>
+#include <pxr/base/tf/stringUtils.h>
+
+#include <tbb/concurrent_unordered_map.h>
 
 #include <mayaUsd/base/debugCodes.h>
 
@@ -37,18 +44,82 @@ static std::shared_ptr<UsdMayaDiagnosticDelegate> _sharedDelegate;
 
 namespace {
 
-class _StatusOnlyDelegate : public UsdUtilsCoalescingDiagnosticDelegate {
-    void IssueWarning(const TfWarning&) override {}
-    void IssueFatalError(const TfCallContext&, const std::string&) override {}
-};
+// Number of messages kept per call site in a batch. The first one is the one
+// displayed, the others are only reported in PXRUSDMAYA_DIAGNOSTICS output.
+constexpr size_t _kMaxSamplesPerSite = 8;
+
+// The statuses or warnings issued from one call site during a batch.
+struct _BatchedSite
+{
+    _BatchedSite(bool isWarning_, size_t order_)
+        : isWarning(isWarning_), order(order_) {}
 
-class _WarningOnlyDelegate : public UsdUtilsCoalescingDiagnosticDelegate {
-    void IssueStatus(const TfStatus&) override {}
-    void IssueFatalError(const TfCallContext&, const std::string&) override {}
+    const bool isWarning;
+    // Order in which the sites were first hit, used to report them in the
+    // order they were issued.
+    const size_t order;
+
+    std::atomic<size_t> count { 0 };
+    std::array<std::string, _kMaxSamplesPerSite> samples;
+    std::array<std::atomic<bool>, _kMaxSamplesPerSite> sampleReady {};
 };
 
+using _BatchedSitePtr = std::shared_ptr<_BatchedSite>;
+
 } // anonymous namespace
 
+// Statuses and warnings collected while batching. Adding to it is thread-safe
+// and doesn't lock: each call site is looked up in a concurrent map, then only
+// atomics are updated, and only the first messages of a site are copied.
+class UsdMayaDiagnosticDelegate::_Batch
+{
+public:
+    void Add(const TfDiagnosticBase& d, bool isWarning)
+    {
+        const TfCallContext& context = d.GetContext();
+        const std::string key = TfStringPrintf("%c%s:%zu:%s",
+                isWarning ? 'W' : 'S',
+                context.GetFile(),
+                context.GetLine(),
+                context.GetFunction());
+
+        auto it = _sites.find(key);
+        if (it == _sites.end()) {
+            // If another thread inserts the same site first, insert() returns
+            // its entry and this one is discarded.
+            it = _sites.insert(std::make_pair(key,
+                    std::make_shared<_BatchedSite>(
+                        isWarning, _siteCount.fetch_add(1)))).first;
+        }
+
+        _BatchedSite& site = *it->second;
+        const size_t index = site.count.fetch_add(1);
+        if (index < _kMaxSamplesPerSite) {
+            site.samples[index] = d.GetCommentary();
+            site.sampleReady[index].store(true, std::memory_order_release);
+        }
+    }
+
+    /// Returns the sites hit so far, in the order they were first hit.
+    std::vector<_BatchedSitePtr> GetSites() const
+    {
+        std::vector<_BatchedSitePtr> sites;
+        sites.reserve(_sites.size());
+        for (const auto& entry : _sites) {
+            sites.push_back(entry.second);
+        }
+        std::sort(sites.begin(), sites.end(),
+                [](const _BatchedSitePtr& a, const _BatchedSitePtr& b) {
+                    return a->order < b->order;
+                });
+        return sites;
+    }
+
+private:
+    tbb::concurrent_unordered_map<std::string, _BatchedSitePtr> _sites;
+    std::atomic<size_t> _siteCount { 0 };
+};
+
 static MString
 _FormatDiagnostic(const TfDiagnosticBase& d)
 {
@@ -63,14 +134,14 @@ _FormatDiagnostic(const TfDiagnosticBase& d)
 }
 
 static MString
-_FormatCoalescedDiagnostic(const UsdUtilsCoalescingDiagnosticDelegateItem& item)
+_FormatBatchedDiagnostic(const _BatchedSite& site)
 {
-    const size_t numItems = item.unsharedItems.size();
+    const size_t numItems = site.count.load();
     const std::string suffix = numItems == 1
             ? std::string()
             : TfStringPrintf(" -- and %zu similar", numItems - 1);
     const std::string message = TfStringPrintf("%s%s",
-            item.unsharedItems[0].commentary.c_str(),
+            site.samples[0].c_str(),
             suffix.c_str());
 
     return message.c_str();
@@ -116,6 +187,11 @@ void
 UsdMayaDiagnosticDelegate::IssueStatus(const TfStatus& status)
 {
     if (_batchCount.load() > 0) {
+        // Hold a reference, the batch may be taken by the main thread while
+        // this thread adds to it.
+        if (std::shared_ptr<_Batch> batch = std::atomic_load(&_batch)) {
+            batch->Add(status, /*isWarning*/ false);
+        }
         return; // Batched.
     }
 
@@ -131,6 +207,11 @@ void
 UsdMayaDiagnosticDelegate::IssueWarning(const TfWarning& warning)
 {
     if (_batchCount.load() > 0) {
+        // Hold a reference, the batch may be taken by the main thread while
+        // this thread adds to it.
+        if (std::shared_ptr<_Batch> batch = std::atomic_load(&_batch)) {
+            batch->Add(warning, /*isWarning*/ true);
+        }
         return; // Batched.
     }
 
@@ -193,11 +274,12 @@ UsdMayaDiagnosticDelegate::_StartBatch()
 {
     TF_AXIOM(ArchIsMainThread());
 
-    if (_batchCount.fetch_add(1) == 0) {
-        // This is the first _StartBatch; add the batching delegates.
-        _batchedStatuses.reset(new _StatusOnlyDelegate());
-        _batchedWarnings.reset(new _WarningOnlyDelegate());
+    if (_batchCount.load() == 0) {
+        // This is the first _StartBatch; start collecting diagnostics before
+        // other threads see the batch count.
+        std::atomic_store(&_batch, std::make_shared<_Batch>());
     }
+    _batchCount.fetch_add(1);
 }
 
 void
@@ -210,11 +292,9 @@ UsdMayaDiagnosticDelegate::_EndBatch()
         TF_FATAL_ERROR("_EndBatch invoked before _StartBatch");
     }
     else if (prevValue == 1) {
-        // This is the last _EndBatch; print the diagnostic messages.
-        // and remove the batching delegates.
+        // This is the last _EndBatch; stop collecting the diagnostic
+        // messages and print them.
         _FlushBatch();
-        _batchedStatuses.reset();
-        _batchedWarnings.reset();
     }
 }
 
@@ -223,22 +303,42 @@ UsdMayaDiagnosticDelegate::_FlushBatch()
 {
     TF_AXIOM(ArchIsMainThread());
 
-    const UsdUtilsCoalescingDiagnosticDelegateVector statuses =
-            _batchedStatuses
-            ? _batchedStatuses->TakeCoalescedDiagnostics()
-            : UsdUtilsCoalescingDiagnosticDelegateVector();
-    const UsdUtilsCoalescingDiagnosticDelegateVector warnings =
-            _batchedWarnings
-            ? _batchedWarnings->TakeCoalescedDiagnostics()
-            : UsdUtilsCoalescingDiagnosticDelegateVector();
+    // Secondary threads still adding to the batch keep it alive until they
+    // are done. Their diagnostics may be missed, but never race with this.
+    const std::shared_ptr<_Batch> batch =
+            std::atomic_exchange(&_batch, std::shared_ptr<_Batch>());
+    if (!batch) {
+        return;
+    }
+
+    // Statuses first, then warnings, each in the order they were issued.
+    const std::vector<_BatchedSitePtr> sites = batch->GetSites();
 
     // Note that we must be in the main thread here, so it's safe to call
     // displayInfo/displayWarning.
-    for (const UsdUtilsCoalescingDiagnosticDelegateItem& item : statuses) {
-        MGlobal::displayInfo(_FormatCoalescedDiagnostic(item));
-    }
-    for (const UsdUtilsCoalescingDiagnosticDelegateItem& item : warnings) {
-        MGlobal::displayWarning(_FormatCoalescedDiagnostic(item));
+    for (const bool warnings : { false, true }) {
+        for (const _BatchedSitePtr& site : sites) {
+            if (site->isWarning != warnings
+                    || !site->sampleReady[0].load(std::memory_order_acquire)) {
+                continue;
+            }
+
+            if (warnings) {
+                MGlobal::displayWarning(_FormatBatchedDiagnostic(*site));
+            }
+            else {
+                MGlobal::displayInfo(_FormatBatchedDiagnostic(*site));
+            }
+
+            const size_t numSamples =
+                    std::min(site->count.load(), _kMaxSamplesPerSite);
+            for (size_t i = 1; i < numSamples; ++i) {
+                if (site->sampleReady[i].load(std::memory_order_acquire)) {
+                    TF_DEBUG(PXRUSDMAYA_DIAGNOSTICS).Msg(
+                            "   similar: %s\n", site->samples[i].c_str());
+                }
+            }
+        }
     }
 }
 
@@ -23,7 +23,6 @@
 
 #include <pxr/pxr.h>
 #include <pxr/base/tf/diagnosticMgr.h>
-#include <pxr/usd/usdUtils/coalescingDiagnosticDelegate.h>
 
 #include <mayaUsd/base/api.h>
 
@@ -35,7 +34,9 @@ class UsdMayaDiagnosticBatchContext;
 ///
 /// Provides an optional batching mechanism for diagnostics; see
 /// UsdMayaDiagnosticBatchContext for more information. Note that errors
-/// are never batched.
+/// are never batched. Batched statuses and warnings are counted per call
+/// site, keeping only the first few messages of each, so that collecting
+/// them stays cheap even when a job issues a very large number of them.
 ///
 /// The IssueError(), IssueStatus(), etc. functions are thread-safe, since Tf
 /// may issue diagnostics from secondary threads. Note that, when not batching,
@@ -79,9 +80,12 @@ public:
 private:
     friend class UsdMayaDiagnosticBatchContext;
 
+    class _Batch;
+
     std::atomic_int _batchCount;
-    std::unique_ptr<UsdUtilsCoalescingDiagnosticDelegate> _batchedStatuses;
-    std::unique_ptr<UsdUtilsCoalescingDiagnosticDelegate> _batchedWarnings;
+    // Only accessed through std::atomic_load() and friends, secondary threads
+    // add to the batch while the main thread may take it.
+    std::shared_ptr<_Batch> _batch;
 
     UsdMayaDiagnosticDelegate();
 
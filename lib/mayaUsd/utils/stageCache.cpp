@@ -15,20 +15,24 @@
 //
 #include "stageCache.h"
 
+#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include <maya/MFileIO.h>
 #include <maya/MSceneMessage.h>
 
+#include <pxr/base/arch/fileSystem.h>
 #include <pxr/usd/sdf/attributeSpec.h>
 #include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/sdf/primSpec.h>
 #include <pxr/usd/sdf/relationshipSpec.h>
 #include <pxr/usd/usd/stageCache.h>
+#include <pxr/usd/usd/stageCacheContext.h>
 #include <pxr/usd/usdGeom/tokens.h>
 
 #include <mayaUsd/listeners/notice.h>
@@ -57,6 +61,130 @@ struct _OnSceneResetListener : public TfWeakBase {
     }
 };
 
+// Stages are identified by the unique identifier of their weak pointers,
+// which stays valid, and isn't reused, as long as a weak pointer to the stage
+// exists. Unlike the stage address, it still identifies a stage that died
+// before its users were removed.
+const void* _GetKey(const UsdStagePtr& stage) { return stage.GetUniqueIdentifier(); }
+
+// A stage opened through UsdMayaStageCache::Open().
+struct _CachedStage
+{
+    UsdStagePtr         stage;
+    UsdStageCache::Id   id;
+    bool                loadAll;
+    size_t              size;
+};
+
+// The users of a stage, see UsdMayaStageCache::AddStageUser().
+struct _StageUsers
+{
+    UsdStagePtr stage;
+    int         count { 0 };
+};
+
+// Memory budget of the stages opened through UsdMayaStageCache::Open(), with
+// the stages ordered from the most to the least recently used.
+struct _StageCacheBudget
+{
+    std::mutex                                                      mutex;
+    size_t                                                          budget { 0 };
+    std::list<_CachedStage>                                         lru;
+    std::unordered_map<const void*, std::list<_CachedStage>::iterator> entries;
+    std::unordered_map<const void*, _StageUsers>                    users;
+    size_t                                                          hits { 0 };
+    size_t                                                          misses { 0 };
+    size_t                                                          evictions { 0 };
+};
+
+_StageCacheBudget& _GetBudget()
+{
+    static _StageCacheBudget budget;
+    return budget;
+}
+
+size_t _EstimateStageMemory(const UsdStageRefPtr& stage)
+{
+    size_t size = 0;
+    for (const SdfLayerHandle& layer : stage->GetUsedLayers()) {
+        if (!layer) {
+            continue;
+        }
+
+        // Anonymous and edited layers differ from what is on disk, if there is
+        // anything on disk at all.
+        if (layer->IsAnonymous() || layer->IsDirty()) {
+            std::string text;
+            if (layer->ExportToString(&text)) {
+                size += text.size();
+            }
+            continue;
+        }
+
+        const int64_t fileLength = ArchGetFileLength(layer->GetRealPath().c_str());
+        if (fileLength > 0) {
+            size += static_cast<size_t>(fileLength);
+        }
+    }
+    return size;
+}
+
+// Drops the stages that were erased from the caches by other means, returns
+// the memory of the remaining ones. Called with the budget mutex locked.
+size_t _PruneAndSum(_StageCacheBudget& budget)
+{
+    size_t usage = 0;
+    for (auto it = budget.lru.begin(); it != budget.lru.end();) {
+        if (!UsdMayaStageCache::Get(it->loadAll).Contains(it->id)) {
+            budget.entries.erase(_GetKey(it->stage));
+            it = budget.lru.erase(it);
+            continue;
+        }
+        usage += it->size;
+        ++it;
+    }
+    return usage;
+}
+
+// Drops the users of stages that no longer exist. Called with the budget mutex
+// locked.
+void _PruneUsers(_StageCacheBudget& budget)
+{
+    for (auto it = budget.users.begin(); it != budget.users.end();) {
+        if (it->second.stage) {
+            ++it;
+        } else {
+            it = budget.users.erase(it);
+        }
+    }
+}
+
+// Erases the least recently used stages without users from the caches until
+// the memory usage is within budget. \p keep is never erased. Called with the
+// budget mutex locked.
+void _EnforceBudget(_StageCacheBudget& budget, const void* keep)
+{
+    if (budget.budget == 0) {
+        return;
+    }
+
+    size_t usage = _PruneAndSum(budget);
+    auto it = budget.lru.end();
+    while (usage > budget.budget && it != budget.lru.begin()) {
+        --it;
+        const void* key = _GetKey(it->stage);
+        if (key == keep || budget.users.count(key)) {
+            continue;
+        }
+
+        UsdMayaStageCache::Get(it->loadAll).Erase(it->id);
+        usage -= it->size;
+        ++budget.evictions;
+        budget.entries.erase(key);
+        it = budget.lru.erase(it);
+    }
+}
+
 } // anonymous namespace
 
 /* static */
@@ -76,6 +204,143 @@ UsdMayaStageCache::Clear()
 {
     Get(true).Clear();
     Get(false).Clear();
+
+    _StageCacheBudget& budget = _GetBudget();
+    std::lock_guard<std::mutex> lock(budget.mutex);
+    budget.lru.clear();
+    budget.entries.clear();
+    _PruneUsers(budget);
+}
+
+/* static */
+UsdStageRefPtr
+UsdMayaStageCache::Open(
+    const SdfLayerHandle& rootLayer,
+    const SdfLayerHandle& sessionLayer,
+    const ArResolverContext& pathResolverContext,
+    UsdStage::InitialLoadSet load)
+{
+    const bool loadAll = (load == UsdStage::InitialLoadSet::LoadAll);
+    UsdStageCache& cache = Get(loadAll);
+    _StageCacheBudget& budget = _GetBudget();
+
+    UsdStageRefPtr stage = sessionLayer
+        ? cache.FindOneMatching(rootLayer, sessionLayer, pathResolverContext)
+        : cache.FindOneMatching(rootLayer, pathResolverContext);
+    if (stage) {
+        std::lock_guard<std::mutex> lock(budget.mutex);
+        ++budget.hits;
+        auto entryIt = budget.entries.find(_GetKey(stage));
+        if (entryIt != budget.entries.end()) {
+            budget.lru.splice(budget.lru.begin(), budget.lru, entryIt->second);
+        }
+        return stage;
+    }
+
+    {
+        UsdStageCacheContext ctx(cache);
+        stage = sessionLayer
+            ? UsdStage::Open(rootLayer, sessionLayer, pathResolverContext, load)
+            : UsdStage::Open(rootLayer, pathResolverContext, load);
+    }
+    if (!stage) {
+        return stage;
+    }
+
+    const size_t size = _EstimateStageMemory(stage);
+
+    std::lock_guard<std::mutex> lock(budget.mutex);
+    ++budget.misses;
+    const void* key = _GetKey(stage);
+    auto entryIt = budget.entries.find(key);
+    if (entryIt != budget.entries.end()) {
+        budget.lru.erase(entryIt->second);
+    }
+    budget.lru.push_front({ stage, cache.GetId(stage), loadAll, size });
+    budget.entries[key] = budget.lru.begin();
+
+    _EnforceBudget(budget, key);
+
+    return stage;
+}
+
+/* static */
+void
+UsdMayaStageCache::SetMemoryBudget(size_t bytes)
+{
+    _StageCacheBudget& budget = _GetBudget();
+    std::lock_guard<std::mutex> lock(budget.mutex);
+    budget.budget = bytes;
+    _EnforceBudget(budget, nullptr);
+}
+
+/* static */
+size_t
+UsdMayaStageCache::GetMemoryBudget()
+{
+    _StageCacheBudget& budget = _GetBudget();
+    std::lock_guard<std::mutex> lock(budget.mutex);
+    return budget.budget;
+}
+
+/* static */
+void
+UsdMayaStageCache::AddStageUser(const UsdStagePtr& stage)
+{
+    if (!stage) {
+        return;
+    }
+
+    _StageCacheBudget& budget = _GetBudget();
+    std::lock_guard<std::mutex> lock(budget.mutex);
+    _PruneUsers(budget);
+    _StageUsers& users = budget.users[_GetKey(stage)];
+    users.stage = stage;
+    ++users.count;
+}
+
+/* static */
+void
+UsdMayaStageCache::RemoveStageUser(const UsdStagePtr& stage)
+{
+    // The stage may have died since it was added, its key is still valid.
+    const void* key = _GetKey(stage);
+    if (!key) {
+        return;
+    }
+
+    _StageCacheBudget& budget = _GetBudget();
+    std::lock_guard<std::mutex> lock(budget.mutex);
+    auto userIt = budget.users.find(key);
+    if (userIt != budget.users.end() && --userIt->second.count <= 0) {
+        budget.users.erase(userIt);
+    }
+}
+
+/* static */
+UsdMayaStageCache::Statistics
+UsdMayaStageCache::GetStatistics()
+{
+    _StageCacheBudget& budget = _GetBudget();
+    std::lock_guard<std::mutex> lock(budget.mutex);
+
+    Statistics statistics;
+    statistics.hits = budget.hits;
+    statistics.misses = budget.misses;
+    statistics.evictions = budget.evictions;
+    statistics.memoryUsage = _PruneAndSum(budget);
+    return statistics;
+}
+
+/* static */
+void
+UsdMayaStageCache::ResetStatistics()
+{
+    _StageCacheBudget& budget = _GetBudget();
+    std::lock_guard<std::mutex> lock(budget.mutex);
+    budget.hits = 0;
+    budget.misses = 0;
+    budget.evictions = 0;
 }
 
 /* static */
@@ -16,10 +16,14 @@
 #ifndef PXRUSDMAYA_STAGECACHE_H
 #define PXRUSDMAYA_STAGECACHE_H
 
+#include <cstddef>
 #include <string>
 
 #include <pxr/pxr.h>
+#include <pxr/usd/ar/resolverContext.h>
+#include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usd/stageCache.h>
 
 #include <mayaUsd/base/api.h>
@@ -41,6 +45,61 @@ public:
     MAYAUSD_CORE_PUBLIC
     static void Clear();
 
+    /// Returns the stage for \p rootLayer and \p sessionLayer from the
+    /// cache matching \p load, opening it and adding it to the cache if
+    /// there is none. If \p sessionLayer is null, any session layer matches
+    /// and a new stage gets an anonymous one, like UsdStage::Open() does.
+    ///
+    /// Lookups are counted in the statistics. Stages opened here are the ones
+    /// accounted in the memory budget, and the least recently used ones
+    /// without users are erased from the cache when it is exceeded.
+    MAYAUSD_CORE_PUBLIC
+    static UsdStageRefPtr Open(
+            const SdfLayerHandle& rootLayer,
+            const SdfLayerHandle& sessionLayer,
+            const ArResolverContext& pathResolverContext,
+            UsdStage::InitialLoadSet load);
+
+    /// Sets the memory budget of the stages opened through Open(), in bytes.
+    /// 0, the default, means no budget: stages stay cached until cleared.
+    ///
+    /// The memory of a stage is estimated from the size of its layers: the
+    /// file size of layers read from disk, the exported size of anonymous
+    /// and dirty ones.
+    MAYAUSD_CORE_PUBLIC
+    static void SetMemoryBudget(size_t bytes);
+
+    /// Returns the memory budget, 0 if there is none.
+    MAYAUSD_CORE_PUBLIC
+    static size_t GetMemoryBudget();
+
+    /// Marks \p stage as used, e.g. by a proxy shape. Stages with users are
+    /// never evicted. Calls must be balanced by RemoveStageUser().
+    MAYAUSD_CORE_PUBLIC
+    static void AddStageUser(const UsdStagePtr& stage);
+
+    /// Releases a use of \p stage added by AddStageUser(). \p stage may have
+    /// expired since.
+    MAYAUSD_CORE_PUBLIC
+    static void RemoveStageUser(const UsdStagePtr& stage);
+
+    struct Statistics
+    {
+        size_t hits = 0;        ///< Open() calls that found the stage in the cache
+        size_t misses = 0;      ///< Open() calls that opened the stage
+        size_t evictions = 0;   ///< Stages erased to stay within the budget
+        size_t memoryUsage = 0; ///< Estimated memory of the cached stages, in bytes
+    };
+
+    /// Returns the lookup and eviction counters since the last call to
+    /// ResetStatistics(), and the current memory usage.
+    MAYAUSD_CORE_PUBLIC
+    static Statistics GetStatistics();
+
+    /// Resets the lookup and eviction counters.
+    MAYAUSD_CORE_PUBLIC
+    static void ResetStatistics();
+
     /// Erase all stages from the stage caches whose root layer path is
     /// \p layerPath.
     ///
@@ -595,7 +595,12 @@ HdMayaShaderParam::HdMayaShaderParam(
 HdMayaMaterialNetworkConverter::HdMayaMaterialNetworkConverter(
     HdMaterialNetwork& network, const SdfPath& prefix,
     PathToMobjMap* pathToMobj)
-    : _network(network), _prefix(prefix), _pathToMobj(pathToMobj) {}
+    : _network(network), _prefix(prefix), _pathToMobj(pathToMobj) {
+    _nodeIndices.reserve(_network.nodes.size());
+    for (size_t i = 0; i < _network.nodes.size(); ++i) {
+        _nodeIndices.emplace(_network.nodes[i].path, i);
+    }
+}
 
 HdMaterialNode* HdMayaMaterialNetworkConverter::GetMaterial(
     const MObject& mayaNode) {
@@ -609,12 +614,10 @@ HdMaterialNode* HdMayaMaterialNetworkConverter::GetMaterial(
     std::string usdNameStr = UsdMayaUtil::SanitizeName(chr);
     const auto materialPath = _prefix.AppendChild(TfToken(usdNameStr));
 
-    auto findResult = std::find_if(
-            _network.nodes.begin(), _network.nodes.end(),
-            [&materialPath](const HdMaterialNode& m) -> bool {
-                return m.path == materialPath;
-        });
-    if (findResult != _network.nodes.end()) { return &(*findResult); }
+    auto findResult = _nodeIndices.find(materialPath);
+    if (findResult != _nodeIndices.end()) {
+        return &_network.nodes[findResult->second];
+    }
 
     auto* nodeConverter = HdMayaMaterialNodeConverter::GetNodeConverter(
         TfToken(node.typeName().asChar()));
@@ -658,6 +661,7 @@ HdMaterialNode* HdMayaMaterialNetworkConverter::GetMaterial(
         }
     }
     if(_pathToMobj) { (*_pathToMobj)[materialPath] = mayaNode; }
+    _nodeIndices.emplace(materialPath, _network.nodes.size());
     _network.nodes.push_back(material);
     return &_network.nodes.back();
 }
@@ -16,6 +16,8 @@
 #ifndef HDMAYA_MATERIAL_NETWORK_CONVERTER_H
 #define HDMAYA_MATERIAL_NETWORK_CONVERTER_H
 
+#include <unordered_map>
+
 #include <maya/MFnDependencyNode.h>
 #include <maya/MObject.h>
 
@@ -169,6 +171,9 @@ private:
     HdMaterialNetwork& _network;
     const SdfPath& _prefix;
     PathToMobjMap* _pathToMobj;
+    /// Index in _network.nodes of each node, by path. Nodes are only ever
+    /// appended to _network.nodes, so indices stay valid.
+    std::unordered_map<SdfPath, size_t, SdfPath::Hash> _nodeIndices;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -15,14 +15,15 @@
 //
 #include "particleWriter.h"
 
+#include <algorithm>
 #include <limits>
-#include <memory>
 #include <set>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <maya/MAnimControl.h>
+#include <maya/MDGContext.h>
 #include <maya/MDoubleArray.h>
 #include <maya/MFnAttribute.h>
 #include <maya/MFnDependencyNode.h>
@@ -47,6 +48,8 @@
 #include <mayaUsd/fileio/utils/writeUtil.h>
 #include <mayaUsd/fileio/writeJobContext.h>
 
+#include <mayaUsdUtils/ArrayConversion.h>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 PXRUSDMAYA_REGISTER_WRITER(particle, PxrUsdTranslators_ParticleWriter);
@@ -57,70 +60,69 @@ PXRUSDMAYA_REGISTER_ADAPTOR_SCHEMA(nParticle, UsdGeomPoints);
 
 
 namespace {
-    template <typename T>
-    inline void _convertVector(T& t, const MVector& v) {
-        // I wish we had concepts
-        // We are guaranteed to have arithmetic types
-        using _t = decltype(+t[0]);
-        t[0] = static_cast<_t>(v.x);
-        t[1] = static_cast<_t>(v.y);
-        t[2] = static_cast<_t>(v.z);
+    static_assert(sizeof(MVector) == 3 * sizeof(double),
+                  "MVector is expected to be three tightly packed doubles");
+
+    // Maya's arrays are contiguous, the non-const subscript operators hand
+    // back references we can take the address of.
+    inline const double* _data(MVectorArray& a) {
+        return a.length() > 0u ? &a[0].x : nullptr;
     }
 
-    template <typename T>
-    using _sharedVtArray = std::shared_ptr<VtArray<T>>;
+    inline const double* _data(MDoubleArray& a) {
+        return a.length() > 0u ? &a[0] : nullptr;
+    }
 
-    template <typename T>
-    _sharedVtArray<T> _convertVectorArray(const MVectorArray& a) {
-        const auto count = a.length();
-        auto* ret = new VtArray<T>(count);
-        for (auto i = decltype(count){0}; i < count; ++i) {
-            _convertVector<T>(ret->operator[](i), a[i]);
-        }
-        return _sharedVtArray<T>(ret);
+    inline const int* _data(MIntArray& a) {
+        return a.length() > 0u ? &a[0] : nullptr;
     }
 
-    template <typename T>
-    _sharedVtArray<T> _convertArray(const MDoubleArray& a) {
-        const auto count = a.length();
-        auto* ret = new VtArray<T>(count);
-        for (auto i = decltype(count){0}; i < count; ++i) {
-            ret->operator[](i) = static_cast<T>(a[i]);
-        }
-        return _sharedVtArray<T>(ret);
+    VtVec3fArray _toVec3fArray(MVectorArray& a, size_t count) {
+        VtVec3fArray ret(count);
+        MayaUsdUtils::convertDoubleToFloat(
+            reinterpret_cast<float*>(ret.data()), _data(a), 3 * count);
+        return ret;
     }
 
-    template <typename T>
-    _sharedVtArray<T> _convertArray(const MIntArray& a) {
-        const auto count = a.length();
-        auto* ret = new VtArray<T>(count);
-        for (auto i = decltype(count){0}; i < count; ++i) {
-            ret->operator[](i) = static_cast<T>(a[i]);
-        }
-        return _sharedVtArray<T>(ret);
+    VtFloatArray _toFloatArray(MDoubleArray& a, size_t count) {
+        VtFloatArray ret(count);
+        MayaUsdUtils::convertDoubleToFloat(ret.data(), _data(a), count);
+        return ret;
     }
 
-    template <typename T>
-    using _strVecPair = std::pair<TfToken, _sharedVtArray<T>>;
+    VtIntArray _toIntArray(MIntArray& a, size_t count) {
+        const int* const data = _data(a);
+        return VtIntArray(data, data + count);
+    }
 
-    template <typename T>
-    using _strVecPairVec = std::vector<_strVecPair<T>>;
+    VtInt64Array _toInt64Array(MIntArray& a, size_t count) {
+        VtInt64Array ret(count);
+        MayaUsdUtils::convertInt32ToInt64(ret.data(), _data(a), count);
+        return ret;
+    }
 
+    // Returns the next unused slot of a channel list, reusing the Maya array
+    // left over from a previous frame if there is one.
     template <typename T>
-    size_t _minCount(const _strVecPairVec<T>& a) {
-        auto mn = std::numeric_limits<size_t>::max();
-        for (const auto& v : a) {
-            mn = std::min(mn, v.second->size());
+    T& _nextChannel(std::vector<std::pair<TfToken, T>>& channels,
+                    size_t& used, const TfToken& name) {
+        if (used == channels.size()) {
+            channels.emplace_back(name, T());
+        } else {
+            channels[used].first = name;
         }
-
-        return mn;
+        return channels[used++].second;
     }
 
     template <typename T>
-    void _resizeVectors(_strVecPairVec<T>& a, size_t size) {
-        for (const auto& v : a) {
-            v.second->resize(size);
+    size_t _minLength(const std::vector<std::pair<TfToken, T>>& channels,
+                      size_t used) {
+        auto mn = std::numeric_limits<size_t>::max();
+        for (size_t i = 0; i < used; ++i) {
+            mn = std::min(mn, static_cast<size_t>(channels[i].second.length()));
         }
+
+        return mn;
     }
 
     template <typename T>
@@ -139,17 +141,6 @@ namespace {
     const TfToken _lifespanName("lifespan");
     const TfToken _massName("mass");
 
-    template <typename T>
-    void _addAttrVec(UsdGeomPoints& points, const SdfValueTypeName& typeName,
-                     const _strVecPairVec<T>& a,
-                     const UsdTimeCode& usdTime,
-                     UsdUtilsSparseValueWriter *valueWriter) {
-        for (const auto& v : a) {
-            _addAttr(points, v.first, typeName, *v.second, usdTime,
-                     valueWriter);
-        }
-    }
-
     // The logic of filtering the user attributes is based on partio4Maya/PartioExport.
     // https://github.com/redpawfx/partio/blob/redpawfx-rez/contrib/partio4Maya/scripts/partioExportGui.mel
     // We either don't want these or already export them using one of the builtin functions.
@@ -245,7 +236,13 @@ PxrUsdTranslators_ParticleWriter::writeParams(
 
     const auto particleNode = GetMayaObject();
     if (particleNode.apiType() != MFn::kNParticle) {
-        auto currentTime = MAnimControl::currentTime();
+        // The export may evaluate the scene in a DG context instead of
+        // changing the current time.
+        MTime currentTime;
+        if (MDGContext::current().isNormal() ||
+                !MDGContext::current().getTime(currentTime)) {
+            currentTime = MAnimControl::currentTime();
+        }
         if (mInitialFrameDone) {
             particleSys.evaluateDynamics(currentTime, false);
             deformedParticleSys.evaluateDynamics(currentTime, false);
@@ -268,64 +265,56 @@ PxrUsdTranslators_ParticleWriter::writeParams(
         return;
     }
 
-    _strVecPairVec<GfVec3f> vectors;
-    _strVecPairVec<float> floats;
-    _strVecPairVec<int> ints;
-
-    MVectorArray mayaVectors;
-    MDoubleArray mayaDoubles;
-    MIntArray mayaInts;
-
-    deformedParticleSys.position(mayaVectors);
-    auto positions = _convertVectorArray<GfVec3f>(mayaVectors);
-    particleSys.velocity(mayaVectors);
-    auto velocities = _convertVectorArray<GfVec3f>(mayaVectors);
-    particleSys.particleIds(mayaInts);
-    auto ids = _convertArray<int64_t>(mayaInts);
-    particleSys.radius(mayaDoubles);
-    auto radii = _convertArray<float>(mayaDoubles);
-    particleSys.mass(mayaDoubles);
-    auto masses = _convertArray<float>(mayaDoubles);
+    // Maya's arrays are only converted once we know how many particles are
+    // valid, and then straight into the arrays that get written.
+    deformedParticleSys.position(mPositions);
+    particleSys.velocity(mVelocities);
+    particleSys.particleIds(mIds);
+    particleSys.radius(mRadii);
+    particleSys.mass(mMasses);
+
+    size_t numVectors = 0;
+    size_t numDoubles = 0;
+    size_t numInts = 0;
 
     if (particleSys.hasRgb()) {
-        particleSys.rgb(mayaVectors);
-        vectors.emplace_back(_rgbName, _convertVectorArray<GfVec3f>(mayaVectors));
+        particleSys.rgb(_nextChannel(mVectorChannels, numVectors, _rgbName));
     }
 
     if (particleSys.hasEmission()) {
-        particleSys.rgb(mayaVectors);
-        vectors.emplace_back(_emissionName, _convertVectorArray<GfVec3f>(mayaVectors));
+        particleSys.rgb(_nextChannel(mVectorChannels, numVectors, _emissionName));
     }
 
     if (particleSys.hasOpacity()) {
-        particleSys.opacity(mayaDoubles);
-        floats.emplace_back(_opacityName, _convertArray<float>(mayaDoubles));
+        particleSys.opacity(_nextChannel(mDoubleChannels, numDoubles, _opacityName));
     }
 
     if (particleSys.hasLifespan()) {
-        particleSys.lifespan(mayaDoubles);
-        floats.emplace_back(_lifespanName, _convertArray<float>(mayaDoubles));
+        particleSys.lifespan(_nextChannel(mDoubleChannels, numDoubles, _lifespanName));
     }
 
     for (const auto& attr : mUserAttributes) {
         MStatus status;
         switch (std::get<2>(attr)) {
         case PER_PARTICLE_INT:
-            particleSys.getPerParticleAttribute(std::get<1>(attr), mayaInts, &status);
-            if (status) {
-                ints.emplace_back(std::get<0>(attr), _convertArray<int>(mayaInts));
+            particleSys.getPerParticleAttribute(std::get<1>(attr),
+                _nextChannel(mIntChannels, numInts, std::get<0>(attr)), &status);
+            if (!status) {
+                --numInts;
             }
             break;
         case PER_PARTICLE_DOUBLE:
-            particleSys.getPerParticleAttribute(std::get<1>(attr), mayaDoubles, &status);
-            if (status) {
-                floats.emplace_back(std::get<0>(attr), _convertArray<float>(mayaDoubles));
+            particleSys.getPerParticleAttribute(std::get<1>(attr),
+                _nextChannel(mDoubleChannels, numDoubles, std::get<0>(attr)), &status);
+            if (!status) {
+                --numDoubles;
             }
             break;
         case PER_PARTICLE_VECTOR:
-            particleSys.getPerParticleAttribute(std::get<1>(attr), mayaVectors, &status);
-            if (status) {
-                vectors.emplace_back(std::get<0>(attr), _convertVectorArray<GfVec3f>(mayaVectors));
+            particleSys.getPerParticleAttribute(std::get<1>(attr),
+                _nextChannel(mVectorChannels, numVectors, std::get<0>(attr)), &status);
+            if (!status) {
+                --numVectors;
             }
             break;
         }
@@ -333,8 +322,14 @@ PxrUsdTranslators_ParticleWriter::writeParams(
 
     const auto minSize = std::min(
         {
-            _minCount(vectors), _minCount(floats), _minCount(ints),
-            positions->size(), velocities->size(), ids->size(), radii->size(), masses->size()
+            _minLength(mVectorChannels, numVectors),
+            _minLength(mDoubleChannels, numDoubles),
+            _minLength(mIntChannels, numInts),
+            static_cast<size_t>(mPositions.length()),
+            static_cast<size_t>(mVelocities.length()),
+            static_cast<size_t>(mIds.length()),
+            static_cast<size_t>(mRadii.length()),
+            static_cast<size_t>(mMasses.length())
         }
     );
 
@@ -342,33 +337,36 @@ PxrUsdTranslators_ParticleWriter::writeParams(
         return;
     }
 
-    _resizeVectors(vectors, minSize);
-    _resizeVectors(floats, minSize);
-    _resizeVectors(ints, minSize);
-    positions->resize(minSize);
-    velocities->resize(minSize);
-    ids->resize(minSize);
-    radii->resize(minSize);
-    masses->resize(minSize);
+    UsdUtilsSparseValueWriter* valueWriter = _GetSparseValueWriter();
 
-    UsdMayaWriteUtil::SetAttribute(points.GetPointsAttr(), positions.get(), usdTime, _GetSparseValueWriter());
-    UsdMayaWriteUtil::SetAttribute(points.GetVelocitiesAttr(), velocities.get(), usdTime, _GetSparseValueWriter());
-    UsdMayaWriteUtil::SetAttribute(points.GetIdsAttr(), ids.get(), usdTime, _GetSparseValueWriter());
+    UsdMayaWriteUtil::SetAttribute(points.GetPointsAttr(),
+        _toVec3fArray(mPositions, minSize), usdTime, valueWriter);
+    UsdMayaWriteUtil::SetAttribute(points.GetVelocitiesAttr(),
+        _toVec3fArray(mVelocities, minSize), usdTime, valueWriter);
+    UsdMayaWriteUtil::SetAttribute(points.GetIdsAttr(),
+        _toInt64Array(mIds, minSize), usdTime, valueWriter);
 
     // radius -> width conversion
-    for (auto& r : *radii) { r = r * 2.0f; }
-    
-    UsdMayaWriteUtil::SetAttribute(points.GetWidthsAttr(), radii.get(), usdTime, _GetSparseValueWriter());
+    VtFloatArray widths = _toFloatArray(mRadii, minSize);
+    for (auto& r : widths) { r = r * 2.0f; }
 
-    _addAttr(points, _massName, SdfValueTypeNames->FloatArray, *masses, usdTime,
-             _GetSparseValueWriter());
+    UsdMayaWriteUtil::SetAttribute(points.GetWidthsAttr(), &widths, usdTime, valueWriter);
+
+    _addAttr(points, _massName, SdfValueTypeNames->FloatArray,
+             _toFloatArray(mMasses, minSize), usdTime, valueWriter);
     // TODO: check if we need the array suffix!!
-    _addAttrVec(points, SdfValueTypeNames->Vector3fArray, vectors, usdTime,
-                _GetSparseValueWriter());
-    _addAttrVec(points, SdfValueTypeNames->FloatArray, floats, usdTime,
-                _GetSparseValueWriter());
-    _addAttrVec(points, SdfValueTypeNames->IntArray, ints, usdTime,
-                _GetSparseValueWriter());
+    for (size_t i = 0; i < numVectors; ++i) {
+        _addAttr(points, mVectorChannels[i].first, SdfValueTypeNames->Vector3fArray,
+                 _toVec3fArray(mVectorChannels[i].second, minSize), usdTime, valueWriter);
+    }
+    for (size_t i = 0; i < numDoubles; ++i) {
+        _addAttr(points, mDoubleChannels[i].first, SdfValueTypeNames->FloatArray,
+                 _toFloatArray(mDoubleChannels[i].second, minSize), usdTime, valueWriter);
+    }
+    for (size_t i = 0; i < numInts; ++i) {
+        _addAttr(points, mIntChannels[i].first, SdfValueTypeNames->IntArray,
+                 _toIntArray(mIntChannels[i].second, minSize), usdTime, valueWriter);
+    }
 }
 
 void
@@ -24,8 +24,11 @@
 #include <utility>
 #include <vector>
 
+#include <maya/MDoubleArray.h>
 #include <maya/MFnDependencyNode.h>
+#include <maya/MIntArray.h>
 #include <maya/MString.h>
+#include <maya/MVectorArray.h>
 
 #include <pxr/pxr.h>
 #include <pxr/base/tf/token.h>
@@ -57,6 +60,17 @@ private:
     std::vector<std::tuple<TfToken, MString, ParticleType>> mUserAttributes;
     bool mInitialFrameDone;
 
+    // Scratch arrays Maya fills in on every frame. Keeping them around lets
+    // their storage be reused instead of reallocated per frame and channel.
+    MVectorArray mPositions;
+    MVectorArray mVelocities;
+    MIntArray mIds;
+    MDoubleArray mRadii;
+    MDoubleArray mMasses;
+    std::vector<std::pair<TfToken, MVectorArray>> mVectorChannels;
+    std::vector<std::pair<TfToken, MDoubleArray>> mDoubleChannels;
+    std::vector<std::pair<TfToken, MIntArray>> mIntChannels;
+
     void initializeUserAttributes();
 };
 
@@ -0,0 +1,124 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "ArrayConversion.h"
+
+#include <cmath>
+
+#include <mayaUsdUtils/SIMD.h>
+
+namespace MayaUsdUtils {
+
+//----------------------------------------------------------------------------------------------------------------------
+void convertDoubleToFloat(float* const output, const double* const input, const size_t count)
+{
+  size_t i = 0;
+
+#ifdef __AVX2__
+
+  const size_t count8 = count & ~7ULL;
+  for(; i < count8; i += 8)
+  {
+    const f128 a = cvt4d_to_4f(loadu4d(input + i));
+    const f128 b = cvt4d_to_4f(loadu4d(input + i + 4));
+    storeu4f(output + i, a);
+    storeu4f(output + i + 4, b);
+  }
+
+#elif defined(__SSE__)
+
+  const size_t count4 = count & ~3ULL;
+  for(; i < count4; i += 4)
+  {
+    const f128 a = cvt2d_to_2f(loadu2d(input + i));
+    const f128 b = cvt2d_to_2f(loadu2d(input + i + 2));
+    storeu4f(output + i, movelh4f(a, b));
+  }
+
+#endif
+
+  for(; i < count; ++i)
+  {
+    output[i] = float(input[i]);
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void convertDoubleToInt64(int64_t* const output, const double* const input, const size_t count)
+{
+  // there is no packed double -> int64 conversion prior to AVX-512, leave this one to the compiler
+  for(size_t i = 0; i < count; ++i)
+  {
+    output[i] = int64_t(input[i]);
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void convertInt32ToInt64(int64_t* const output, const int32_t* const input, const size_t count)
+{
+  size_t i = 0;
+
+#ifdef __AVX2__
+
+  const size_t count4 = count & ~3ULL;
+  for(; i < count4; i += 4)
+  {
+    storeu8i(output + i, cvt4i32_to_4i64(loadu4i(input + i)));
+  }
+
+#elif defined(__SSE4_1__)
+
+  const size_t count4 = count & ~3ULL;
+  for(; i < count4; i += 4)
+  {
+    const i128 a = loadu4i(input + i);
+    storeu4i(output + i, cvt2i32_to_2i64(a));
+    storeu4i(output + i + 2, cvt2i32_to_2i64(movehl4i(a, a)));
+  }
+
+#endif
+
+  for(; i < count; ++i)
+  {
+    output[i] = input[i];
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void convertEulerXYZToQuath(PXR_NS::GfQuath* const output, const double* const input, const size_t count)
+{
+  // Closed form of qz * qy * qx, which is what composing the three GfRotations amounts to. This avoids the
+  // axis/angle round trips GfRotation makes for each multiplication.
+  const double halfDegreesToRadians = 3.14159265358979323846 / 360.0;
+  for(size_t i = 0; i < count; ++i)
+  {
+    const double* const euler = input + 3 * i;
+    const double hx = euler[0] * halfDegreesToRadians;
+    const double hy = euler[1] * halfDegreesToRadians;
+    const double hz = euler[2] * halfDegreesToRadians;
+    const double cx = std::cos(hx), sx = std::sin(hx);
+    const double cy = std::cos(hy), sy = std::sin(hy);
+    const double cz = std::cos(hz), sz = std::sin(hz);
+
+    output[i] = PXR_NS::GfQuath(
+      PXR_NS::GfHalf(float(cx * cy * cz + sx * sy * sz)),
+      PXR_NS::GfVec3h(
+        PXR_NS::GfHalf(float(sx * cy * cz - cx * sy * sz)),
+        PXR_NS::GfHalf(float(cx * sy * cz + sx * cy * sz)),
+        PXR_NS::GfHalf(float(cx * cy * sz - sx * sy * cz))));
+  }
+}
+
+} // MayaUsdUtils
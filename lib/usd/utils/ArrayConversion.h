@@ -0,0 +1,66 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <pxr/pxr.h>
+#include <pxr/base/gf/quath.h>
+
+#include <mayaUsdUtils/Api.h>
+
+namespace MayaUsdUtils {
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  converts an array of doubles to floats. Vector arrays (e.g. MVector -> GfVec3f) can be converted by passing
+///         the number of scalars rather than the number of vectors.
+/// \param  output the array that receives the converted values, must hold at least count elements
+/// \param  input the values to convert
+/// \param  count the number of elements to convert
+//----------------------------------------------------------------------------------------------------------------------
+MAYA_USD_UTILS_PUBLIC
+void convertDoubleToFloat(float* output, const double* input, size_t count);
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  converts an array of doubles to 64bit integers, truncating towards zero
+/// \param  output the array that receives the converted values, must hold at least count elements
+/// \param  input the values to convert
+/// \param  count the number of elements to convert
+//----------------------------------------------------------------------------------------------------------------------
+MAYA_USD_UTILS_PUBLIC
+void convertDoubleToInt64(int64_t* output, const double* input, size_t count);
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  converts an array of 32bit integers to 64bit integers
+/// \param  output the array that receives the converted values, must hold at least count elements
+/// \param  input the values to convert
+/// \param  count the number of elements to convert
+//----------------------------------------------------------------------------------------------------------------------
+MAYA_USD_UTILS_PUBLIC
+void convertInt32ToInt64(int64_t* output, const int32_t* input, size_t count);
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  converts an array of XYZ euler rotations, in degrees, to half precision quaternions. The result matches
+///         GfRotation(X, x) * GfRotation(Y, y) * GfRotation(Z, z), i.e. X is applied first.
+/// \param  output the array that receives the quaternions, must hold at least count elements
+/// \param  input the euler rotations to convert, 3 doubles per rotation
+/// \param  count the number of rotations to convert
+//----------------------------------------------------------------------------------------------------------------------
+MAYA_USD_UTILS_PUBLIC
+void convertEulerXYZToQuath(PXR_NS::GfQuath* output, const double* input, size_t count);
+
+} // MayaUsdUtils
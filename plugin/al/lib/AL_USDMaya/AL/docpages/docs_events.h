@@ -708,4 +708,40 @@ for($event in $childEventIds)
 \endcode
 
 
+\subsection editBlocks Edit Blocks
+
+Some operations (e.g. a large resync of a USD stage) can end up triggering the same node event many times in quick
+succession. Rather than running the callbacks of that event each time, the operation can be wrapped within an edit
+block. Node events triggered with triggerOrDeferEvent within the block are queued, and each event is dispatched once
+when the outermost block ends. triggerEvent always dispatches immediately, so Pre/Post pairs keep surrounding what they
+report.
+
+\code
+void MyMayaNode::lotsOfThingsHappened()
+{
+  AL::event::EventEditBlock block(*scheduler());
+  for(auto& thing : m_things)
+  {
+    // only queues the event, the callbacks run once when 'block' goes out of scope
+    triggerOrDeferEvent("ThingChanged");
+  }
+}
+\endcode
+
+Since the callbacks run at the end of the block, only events whose callbacks do not need to run at a specific point
+within the operation (unlike the "Pre" half of a Pre/Post pair) should be deferred. The ProxyShape opens an edit block
+while it processes the changes of its stage, and triggers "VariantSwitchEnded" that way after each
+PreVariantChanged/PostVariantChanged pair: a layer change that switches the variants of many prims sends one pair per
+prim, but "VariantSwitchEnded" only once.
+
+The AL_usdmaya_EventQuery command can report how many times an event has been dispatched, how many triggers were
+merged by edit blocks, and how long its callbacks have taken to run in total:
+
+\code
+print `AL_usdmaya_EventQuery -triggerCount "ThingChanged" $node`;
+print `AL_usdmaya_EventQuery -coalescedCount "ThingChanged" $node`;
+print `AL_usdmaya_EventQuery -triggerTime "ThingChanged" $node`;
+AL_usdmaya_EventQuery -resetStatistics "ThingChanged" $node;
+\endcode
+
 */
@@ -33,6 +33,7 @@
 #include "AL/usdmaya/fileio/Import.h"
 #include "AL/usdmaya/fileio/ImportTranslator.h"
 #include "AL/usdmaya/nodes/Layer.h"
+#include "AL/usdmaya/nodes/LayerBinaryData.h"
 #include "AL/usdmaya/nodes/LayerManager.h"
 #include "AL/usdmaya/nodes/MeshAnimCreator.h"
 #include "AL/usdmaya/nodes/MeshAnimDeformer.h"
@@ -304,6 +305,7 @@ MStatus registerPlugin(AFnPlugin& plugin)
   AL_REGISTER_TRANSFORM_NODE(plugin, AL::usdmaya::nodes::Transform, AL::usdmaya::nodes::TransformationMatrix);
   AL_REGISTER_DEPEND_NODE(plugin, AL::usdmaya::nodes::RendererManager);
   AL_REGISTER_DEPEND_NODE(plugin, AL::usdmaya::nodes::Layer);
+  AL_REGISTER_DATA(plugin, AL::usdmaya::nodes::LayerBinaryData);
   AL_REGISTER_DEPEND_NODE(plugin, AL::usdmaya::nodes::MeshAnimCreator);
   AL_REGISTER_DEPEND_NODE(plugin, AL::usdmaya::nodes::MeshAnimDeformer);
   AL_REGISTER_DEPEND_NODE(plugin, AL::usdmaya::nodes::ProxyUsdGeomCamera);
@@ -464,6 +466,7 @@ MStatus unregisterPlugin(AFnPlugin& plugin)
   AL_UNREGISTER_NODE(plugin, AL::usdmaya::nodes::RendererManager);
   AL_UNREGISTER_NODE(plugin, AL::usdmaya::nodes::Layer);
   AL_UNREGISTER_NODE(plugin, AL::usdmaya::nodes::LayerManager);
+  AL_UNREGISTER_DATA(plugin, AL::usdmaya::nodes::LayerBinaryData);
 
   AL::usdmaya::Global::onPluginUnload();
   return status;
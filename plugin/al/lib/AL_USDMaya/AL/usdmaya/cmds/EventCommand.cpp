@@ -25,6 +25,8 @@
 #include <maya/MSelectionList.h>
 #include <maya/MSyntax.h>
 
+#include <chrono>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace AL {
@@ -846,6 +848,10 @@ MSyntax EventQuery::createSyntax()
   syntax.addFlag("-h", "-help");
   syntax.addFlag("-e", "-eventId");
   syntax.addFlag("-p", "-parentId");
+  syntax.addFlag("-tc", "-triggerCount");
+  syntax.addFlag("-cc", "-coalescedCount");
+  syntax.addFlag("-tt", "-triggerTime");
+  syntax.addFlag("-rs", "-resetStatistics");
   syntax.addArg(MSyntax::kString);
   syntax.useSelectionAsDefault(false);
   syntax.setObjectType(MSyntax::kSelectionList, 0, 1);
@@ -910,6 +916,26 @@ MStatus EventQuery::doIt(const MArgList& args)
         setResult(eventId);
       }
       else
+      if(database.isFlagSet("-tc"))
+      {
+        setResult(int(dispatcher->triggerCount()));
+      }
+      else
+      if(database.isFlagSet("-cc"))
+      {
+        setResult(int(dispatcher->coalescedCount()));
+      }
+      else
+      if(database.isFlagSet("-tt"))
+      {
+        setResult(std::chrono::duration<double, std::milli>(dispatcher->triggerTime()).count());
+      }
+      else
+      if(database.isFlagSet("-rs"))
+      {
+        dispatcher->resetStatistics();
+      }
+      else
       {
         MGlobal::displayError("AL_usdmaya_EventQuery: no flag specified");
         return MS::kFailure;
@@ -1138,6 +1164,30 @@ Parent Events
 const char* const EventQuery::g_helpText =  R"(
     AL_usdmaya_EventQuery Overview:
 
+    Given the name of an event (and optionally the node it is registered on), this command returns some information
+about that event. e.g.
+
+      // print the internal event ID
+      AL_usdmaya_EventQuery -eventId "eventName";
+
+      // print the callback ID that triggers this event (as a pair of integers)
+      AL_usdmaya_EventQuery -parentId "eventName" "mayaNode";
+
+    The event system also keeps some statistics about each event, which can be useful when tracking down slow
+callbacks:
+
+      // the number of times the callbacks of the event have been run
+      AL_usdmaya_EventQuery -triggerCount "eventName";
+
+      // the number of times the event was raised within an edit block, and merged with an already queued dispatch
+      AL_usdmaya_EventQuery -coalescedCount "eventName";
+
+      // the total time (in milliseconds) spent running the callbacks of the event
+      AL_usdmaya_EventQuery -triggerTime "eventName";
+
+      // resets the above statistics
+      AL_usdmaya_EventQuery -resetStatistics "eventName";
+
 )";
 
 //----------------------------------------------------------------------------------------------------------------------
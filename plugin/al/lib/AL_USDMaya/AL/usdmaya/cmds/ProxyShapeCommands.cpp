@@ -1450,10 +1450,6 @@ MStatus TranslatePrim::doIt(const MArgList& args)
     if(m_recursive)
     {
       const bool forceImport = db.isFlagSet("-fi");
-      MFnDagNode fn(m_proxy->thisMObject());
-      MDagPath proxyTransformPath;
-      fn.getPath(proxyTransformPath);
-      proxyTransformPath.pop();
 
       auto& manufacture = m_proxy->translatorManufacture();
 
@@ -1471,7 +1467,7 @@ MStatus TranslatePrim::doIt(const MArgList& args)
             }
           }
         }
-        auto newPrimSet = m_proxy->huntForNativeNodesUnderPrim(proxyTransformPath, importPath, manufacture, forceImport);
+        auto newPrimSet = m_proxy->huntForNativeNodesUnderPrim(importPath, manufacture, forceImport);
         for(auto it : newPrimSet)
         {
           newImportPaths.push_back(it.GetPath());
@@ -1492,7 +1488,7 @@ MStatus TranslatePrim::doIt(const MArgList& args)
             }
           }
         }
-        auto newPrimSet = m_proxy->huntForNativeNodesUnderPrim(proxyTransformPath, teardownPath, manufacture, true);
+        auto newPrimSet = m_proxy->huntForNativeNodesUnderPrim(teardownPath, manufacture, true);
         for(auto it : newPrimSet)
         {
           newTeardownPaths.push_back(it.GetPath());
@@ -1513,7 +1509,7 @@ MStatus TranslatePrim::doIt(const MArgList& args)
             }
           }
         }
-        auto newPrimSet = m_proxy->huntForNativeNodesUnderPrim(proxyTransformPath, updatePath, manufacture, true);
+        auto newPrimSet = m_proxy->huntForNativeNodesUnderPrim(updatePath, manufacture, true);
         for(auto it : newPrimSet)
         {
           // We only want to list the prims that are actually updateable.
@@ -21,11 +21,22 @@
 
 #include <maya/MAnimControl.h>
 #include <maya/MAnimUtil.h>
+#include <maya/MDGContext.h>
+#include <maya/MDGContextGuard.h>
 #include <maya/MFnAnimCurve.h>
 #include <maya/MFnDagNode.h>
+#include <maya/MFnMatrixData.h>
+#include <maya/MFnMesh.h>
+#include <maya/MGlobal.h>
 #include <maya/MItDependencyGraph.h>
 #include <maya/MMatrix.h>
 #include <maya/MNodeClass.h>
+#include <maya/MTime.h>
+
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/usdGeom/mesh.h>
+
+#include <cstring>
 
 namespace AL {
 namespace usdmaya {
@@ -55,10 +66,46 @@ void AnimationTranslator::exportAnimation(const ExporterParams& params)
      (startWSM != endWSM) ||
      (!m_animatedNodes.empty()))
   {
+    // the plugs of the meshes and world space matrices are resolved once, their values are then pulled at each frame
+    struct AnimatedMesh
+    {
+      MPlug outMesh;
+      UsdAttribute points;
+      MObject meshData;
+      const float* rawPoints;
+      uint32_t numVertices;
+    };
+    std::vector<AnimatedMesh> animatedMeshes;
+    animatedMeshes.reserve(m_animatedMeshes.size());
+    for(auto it = startMesh; it != endMesh; ++it)
+    {
+      MFnDagNode fn(it->first);
+      UsdGeomMesh mesh(it->second.GetPrim());
+      animatedMeshes.push_back({fn.findPlug("outMesh", true), mesh.GetPointsAttr(), MObject(), nullptr, 0});
+    }
+    std::vector<VtArray<GfVec3f>> meshPoints(animatedMeshes.size());
+
+    std::vector<std::pair<MPlug, UsdAttribute>> worldSpaceOutputs;
+    worldSpaceOutputs.reserve(m_worldSpaceOutputs.size());
+    for(auto it = startWSM; it != endWSM; ++it)
+    {
+      MFnDagNode fn(it->first);
+      MPlug worldMatrix = fn.findPlug("worldMatrix", true).elementByLogicalIndex(it->first.instanceNumber());
+      worldSpaceOutputs.emplace_back(worldMatrix, it->second);
+    }
+
     double increment = 1.0 / std::max(1U, params.m_subSamples);
     for(double t = params.m_minFrame, e = params.m_maxFrame + 1e-3f; t < e; t += increment)
     {
-      MAnimControl::setCurrentTime(t);
+      // custom translators may read anything from maya, so they still need the current time to be set. Everything
+      // else is pulled from the DG at the time of the context, without changing the current time.
+      if(!m_animatedNodes.empty())
+      {
+        MAnimControl::setCurrentTime(t);
+      }
+      MDGContext context(MTime(t, MTime::uiUnit()));
+      MDGContextGuard contextGuard(context);
+
       UsdTimeCode timeCode(t);
       for(auto it = startAttrib; it != endAttrib; ++it)
       {
@@ -99,24 +146,66 @@ void AnimationTranslator::exportAnimation(const ExporterParams& params)
           }
         }
       }
-      for(auto it = startMesh; it != endMesh; ++it)
+      if(!animatedMeshes.empty())
       {
-        UsdGeomMesh mesh(it->second.GetPrim());
-        AL::usdmaya::utils::MeshExportContext context(it->first, mesh, timeCode);
-        context.copyVertexData(timeCode);
+        // the meshes have to be evaluated on this thread, but their vertices can be copied on any
+        for(auto& animatedMesh : animatedMeshes)
+        {
+          MStatus status;
+          animatedMesh.meshData = animatedMesh.outMesh.asMObject();
+          animatedMesh.rawPoints = nullptr;
+          MFnMesh fnMesh(animatedMesh.meshData, &status);
+          if(status)
+          {
+            animatedMesh.rawPoints = fnMesh.getRawPoints(&status);
+            animatedMesh.numVertices = fnMesh.numVertices();
+          }
+          if(!status)
+          {
+            animatedMesh.rawPoints = nullptr;
+            MGlobal::displayError(MString("Unable to access mesh vertices on mesh: ") + animatedMesh.outMesh.name());
+          }
+        }
+
+        WorkParallelForN(animatedMeshes.size(), [&animatedMeshes, &meshPoints](size_t begin, size_t end)
+        {
+          for(size_t i = begin; i < end; ++i)
+          {
+            const AnimatedMesh& animatedMesh = animatedMeshes[i];
+            if(animatedMesh.rawPoints)
+            {
+              meshPoints[i].resize(animatedMesh.numVertices);
+              std::memcpy((GfVec3f*)meshPoints[i].data(), animatedMesh.rawPoints, sizeof(float) * 3 * animatedMesh.numVertices);
+            }
+          }
+        });
+
+        // authoring to the layer is not thread safe, so the values are set in order
+        for(size_t i = 0, n = animatedMeshes.size(); i < n; ++i)
+        {
+          AnimatedMesh& animatedMesh = animatedMeshes[i];
+          if(animatedMesh.rawPoints && animatedMesh.points)
+          {
+            animatedMesh.points.Set(meshPoints[i], timeCode);
+          }
+          animatedMesh.meshData = MObject();
+          animatedMesh.rawPoints = nullptr;
+          meshPoints[i] = VtArray<GfVec3f>();
+        }
       }
       for(auto nodeAnim : m_animatedNodes)
       {
         nodeAnim.m_translator->exportCustomAnim(nodeAnim.m_path, nodeAnim.m_prim, timeCode);
       }
-      for(auto it = startWSM; it != endWSM; ++it)
+      for(auto& worldSpaceOutput : worldSpaceOutputs)
       {
-        MMatrix mat = it->first.inclusiveMatrix();
+        MFnMatrixData fnMatrix(worldSpaceOutput.first.asMObject());
+        MMatrix mat = fnMatrix.matrix();
 #ifdef __GNUC__
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wstrict-aliasing"
 #endif
-        it->second.Set(*(const GfMatrix4d*)&mat, timeCode);
+        worldSpaceOutput.second.Set(*(const GfMatrix4d*)&mat, timeCode);
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif
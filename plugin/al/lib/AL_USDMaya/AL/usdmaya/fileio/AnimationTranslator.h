@@ -43,7 +43,9 @@ class AnimationTranslator : public usdmaya::utils::AnimationTranslator
 {
 public:
 
-  /// \brief  After the scene has been exported, call this method to export the animation data on various attributes
+  /// \brief  After the scene has been exported, call this method to export the animation data on various attributes.
+  ///         The values are pulled from the DG in the context of each sample time, the current time is only changed
+  ///         when custom translators export animation.
   /// \param  params the export options
   AL_USDMAYA_PUBLIC
   void exportAnimation(const ExporterParams& params);
@@ -34,6 +34,17 @@
 #include <maya/MPlugArray.h>
 #include <maya/MSyntax.h>
 
+#include <pxr/base/gf/half.h>
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/quatf.h>
+#include <pxr/base/gf/quath.h>
+#include <pxr/base/gf/vec2f.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/gf/vec4f.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/sdf/changeBlock.h>
 #include <pxr/usd/usdGeom/xform.h>
 #include <pxr/usd/usdGeom/mesh.h>
 #include <pxr/usd/usdGeom/nurbsCurves.h>
@@ -124,6 +135,139 @@ static inline SdfPath makeMasterPath(UsdPrim instancesPrim, const MDagPath& dagP
   return SdfPath(usdPath);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  Appends to timesToClear the samples of attr that filterSamples removes. Samples that fail to read compare
+///         equal to each other only.
+//----------------------------------------------------------------------------------------------------------------------
+template<typename T>
+static void findRedundantSamples(
+  const UsdAttribute& attr,
+  const std::vector<double>& timeSamples,
+  std::vector<double>& timesToClear)
+{
+  std::vector<double> dupSamples;
+  T prevSample;
+  T currSample;
+  bool prevValid = false;
+  for (auto sample : timeSamples)
+  {
+    const bool currValid = attr.Get(&currSample, sample);
+    if (currValid == prevValid && (!currValid || currSample == prevSample))
+    {
+      dupSamples.emplace_back(sample);
+    }
+    else
+    {
+      std::swap(prevSample, currSample);
+      prevValid = currValid;
+      // only clear samples between constant segment
+      if (dupSamples.size() > 1)
+      {
+        dupSamples.pop_back();
+        timesToClear.insert(timesToClear.end(), dupSamples.begin(), dupSamples.end());
+      }
+      dupSamples.clear();
+    }
+  }
+  timesToClear.insert(timesToClear.end(), dupSamples.begin(), dupSamples.end());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  Compares the samples as their typed value for the common attribute types, falls back on VtValue otherwise.
+//----------------------------------------------------------------------------------------------------------------------
+static void findRedundantSamples(const UsdAttribute& attr, std::vector<double>& timesToClear)
+{
+  std::vector<double> timeSamples;
+  if (!attr.GetTimeSamples(&timeSamples) || timeSamples.size() < 2)
+    return;
+
+  const TfType type = attr.GetTypeName().GetType();
+  if (type == TfType::Find<float>())
+    findRedundantSamples<float>(attr, timeSamples, timesToClear);
+  else if (type == TfType::Find<double>())
+    findRedundantSamples<double>(attr, timeSamples, timesToClear);
+  else if (type == TfType::Find<GfHalf>())
+    findRedundantSamples<GfHalf>(attr, timeSamples, timesToClear);
+  else if (type == TfType::Find<int>())
+    findRedundantSamples<int>(attr, timeSamples, timesToClear);
+  else if (type == TfType::Find<bool>())
+    findRedundantSamples<bool>(attr, timeSamples, timesToClear);
+  else if (type == TfType::Find<GfVec2f>())
+    findRedundantSamples<GfVec2f>(attr, timeSamples, timesToClear);
+  else if (type == TfType::Find<GfVec3f>())
+    findRedundantSamples<GfVec3f>(attr, timeSamples, timesToClear);
+  else if (type == TfType::Find<GfVec3d>())
+    findRedundantSamples<GfVec3d>(attr, timeSamples, timesToClear);
+  else if (type == TfType::Find<GfVec4f>())
+    findRedundantSamples<GfVec4f>(attr, timeSamples, timesToClear);
+  else if (type == TfType::Find<GfQuatf>())
+    findRedundantSamples<GfQuatf>(attr, timeSamples, timesToClear);
+  else if (type == TfType::Find<GfQuath>())
+    findRedundantSamples<GfQuath>(attr, timeSamples, timesToClear);
+  else if (type == TfType::Find<GfMatrix4d>())
+    findRedundantSamples<GfMatrix4d>(attr, timeSamples, timesToClear);
+  else if (type == TfType::Find<VtFloatArray>())
+    findRedundantSamples<VtFloatArray>(attr, timeSamples, timesToClear);
+  else if (type == TfType::Find<VtIntArray>())
+    findRedundantSamples<VtIntArray>(attr, timeSamples, timesToClear);
+  else if (type == TfType::Find<VtVec2fArray>())
+    findRedundantSamples<VtVec2fArray>(attr, timeSamples, timesToClear);
+  else if (type == TfType::Find<VtVec3fArray>())
+    findRedundantSamples<VtVec3fArray>(attr, timeSamples, timesToClear);
+  else
+    findRedundantSamples<VtValue>(attr, timeSamples, timesToClear);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void filterSamples(const UsdStageRefPtr& stage)
+{
+  if (!stage)
+    return;
+
+  // samples can only be erased from the edit target, attributes without a spec in it are left alone, e.g. the ones
+  // whose samples come from a referenced layer.
+  const UsdEditTarget& editTarget = stage->GetEditTarget();
+  const SdfLayerHandle& layer = editTarget.GetLayer();
+  std::vector<UsdAttribute> attributes;
+  SdfPathVector specPaths;
+  for (auto prim : stage->Traverse())
+  {
+    for (auto attr : prim.GetAuthoredAttributes())
+    {
+      if (attr.GetNumTimeSamples() <= 1)
+        continue;
+
+      SdfPath specPath = editTarget.MapToSpecPath(attr.GetPath());
+      if (!layer->HasSpec(specPath))
+        continue;
+
+      attributes.emplace_back(std::move(attr));
+      specPaths.emplace_back(std::move(specPath));
+    }
+  }
+
+  // reading is thread safe, so the samples of each attribute are compared in parallel.
+  std::vector<std::vector<double>> timesToClear(attributes.size());
+  WorkParallelForN(attributes.size(), [&attributes, &timesToClear](size_t begin, size_t end)
+  {
+    for (size_t i = begin; i < end; ++i)
+    {
+      findRedundantSamples(attributes[i], timesToClear[i]);
+    }
+  });
+
+  // and the samples are removed in one go, so that the stage only processes a single change notification.
+  const SdfLayerOffset stageToLayer = editTarget.GetMapFunction().GetTimeOffset().GetInverse();
+  SdfChangeBlock changeBlock;
+  for (size_t i = 0, n = attributes.size(); i < n; ++i)
+  {
+    for (auto time : timesToClear[i])
+    {
+      layer->EraseTimeSample(specPaths[i], stageToLayer * time);
+    }
+  }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /// Internal USD exporter implementation
 //----------------------------------------------------------------------------------------------------------------------
@@ -231,56 +375,12 @@ struct Export::Impl
     }
   }
 
-  void filterSample()
-  {
-    std::vector<double> timeSamples;
-    std::vector<double> dupSamples;
-    for (auto prim : m_stage->Traverse())
-    {
-      std::vector<UsdAttribute> attributes = prim.GetAuthoredAttributes();
-      for (auto attr : attributes)
-      {
-        timeSamples.clear();
-        dupSamples.clear();
-        attr.GetTimeSamples(&timeSamples);
-        VtValue prevSampleBlob;
-        for (auto sample : timeSamples)
-        {
-          VtValue currSampleBlob;
-          attr.Get(&currSampleBlob, sample);
-          if (prevSampleBlob == currSampleBlob)
-          {
-            dupSamples.emplace_back(sample);
-          }
-          else
-          {
-            prevSampleBlob = currSampleBlob;
-            // only clear samples between constant segment
-            if (dupSamples.size() > 1)
-            {
-              dupSamples.pop_back();
-              for (auto dup : dupSamples)
-              {
-                attr.ClearAtTime(dup);
-              }
-            }
-            dupSamples.clear();
-          }
-        }
-        for (auto dup : dupSamples)
-        {
-          attr.ClearAtTime(dup);
-        }
-      }
-    }
-  }
-
   void doExport(const char* const filename, bool toFilter = false, SdfPath defaultPrim = SdfPath())
   {
     setDefaultPrimIfOnlyOneRoot(defaultPrim);
     if (toFilter)
     {
-      filterSample();
+      filterSamples(m_stage);
     }
     m_stage->GetRootLayer()->Save();
     m_nodeMap.clear();
@@ -21,6 +21,7 @@
 
 #include <pxr/pxr.h>
 #include "AL/usdmaya/utils/ForwardDeclares.h"
+#include "AL/usdmaya/Api.h"
 #include "AL/maya/utils/Api.h"
 #include "AL/maya/utils/MayaHelperMacros.h"
 
@@ -89,6 +90,17 @@ private:
 
 };
 
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  Removes the redundant time samples of the attributes of the stage, in its edit target. Within each run of
+///         adjacent samples holding the same value, the first and last samples are kept and the ones in between are
+///         removed. If the last run goes up to the last sample, only its first sample is kept.
+/// \param  stage the stage to filter
+/// \note   The samples are compared in parallel, per attribute, and removed in a single change block.
+/// \ingroup   fileio
+//----------------------------------------------------------------------------------------------------------------------
+AL_USDMAYA_PUBLIC
+void filterSamples(const UsdStageRefPtr& stage);
+
 //----------------------------------------------------------------------------------------------------------------------
 /// \brief  A thin MEL command layer that just wraps the AL::usdmaya::fileio::Export process.
 /// \ingroup   fileio
@@ -14,10 +14,18 @@
 // limitations under the License.
 //
 #include "AL/usdmaya/fileio/SchemaPrims.h"
+#include "AL/usdmaya/DebugCodes.h"
+#include "AL/usdmaya/Metadata.h"
 
 #include <maya/MFnDagNode.h>
 
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/usd/primRange.h>
 #include <pxr/usd/usd/schemaBase.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <algorithm>
+#include <iterator>
 
 namespace AL {
 namespace usdmaya {
@@ -104,6 +112,312 @@ fileio::translators::TranslatorRefPtr SchemaPrimsUtils::isSchemaPrim(const UsdPr
   return m_manufacture.get(prim);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  the prims indexed are the ones fileio::TransformIterator visits, through UsdPrim::GetChildren(). The prim
+///         flags of this predicate hold for a prim only if they hold for its ancestors.
+static const Usd_PrimFlagsConjunction& traversalPredicate()
+{
+  return UsdPrimDefaultPredicate;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+SchemaPrimIndex::SchemaPrimIndex()
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+SchemaPrimIndex::~SchemaPrimIndex()
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void SchemaPrimIndex::clear()
+{
+  m_stage = UsdStageWeakPtr();
+  m_manufacture = nullptr;
+  m_schemaTypeNames.clear();
+  m_assetTypes.clear();
+  m_schemaPrims.clear();
+  m_instances.clear();
+  m_masters.clear();
+  m_resyncedPaths.clear();
+  m_changedPrimPaths.clear();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void SchemaPrimIndex::processChangedObjects(UsdNotice::ObjectsChanged const& notice, UsdStageWeakPtr const& sender)
+{
+  if(!m_stage || sender != m_stage)
+    return;
+
+  // only record the changes, the index is updated when queried
+  for(const SdfPath& path : notice.GetResyncedPaths())
+  {
+    if(path.IsAbsoluteRootOrPrimPath())
+      m_resyncedPaths.push_back(path);
+  }
+
+  // the assettype metadata can change without a resync
+  if(!m_assetTypes.empty())
+  {
+    for(const SdfPath& path : notice.GetChangedInfoOnlyPaths())
+    {
+      if(path.IsPrimPath())
+        m_changedPrimPaths.push_back(path);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool SchemaPrimIndex::isSchemaPrim(const UsdPrim& prim, std::unordered_map<TfToken, bool, TfToken::HashFunctor>& typeCache) const
+{
+  if(!m_assetTypes.empty())
+  {
+    std::string assetType;
+    if(prim.GetMetadata(Metadata::assetType, &assetType) && m_assetTypes.count(assetType))
+      return true;
+  }
+
+  const TfToken& typeName = prim.GetTypeName();
+  if(typeName.IsEmpty())
+    return false;
+
+  auto it = typeCache.find(typeName);
+  if(it == typeCache.end())
+  {
+    const TfType type = TfType::FindDerivedByName<UsdSchemaBase>(typeName);
+    it = typeCache.emplace(typeName, m_schemaTypeNames.count(type.GetTypeName()) > 0).first;
+  }
+  return it->second;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void SchemaPrimIndex::indexSubtrees(const std::vector<UsdPrim>& roots)
+{
+  // Split the subtrees until there is enough work to share between threads. The prims that are split are indexed
+  // on their own.
+  std::vector<UsdPrim> subtrees;
+  std::copy_if(roots.begin(), roots.end(), std::back_inserter(subtrees), traversalPredicate());
+  std::vector<UsdPrim> splitPrims;
+  const size_t minSubtrees = 64;
+  for(int level = 0; level < 2 && !subtrees.empty() && subtrees.size() < minSubtrees; ++level)
+  {
+    std::vector<UsdPrim> children;
+    for(const UsdPrim& prim : subtrees)
+    {
+      splitPrims.push_back(prim);
+      for(const UsdPrim& child : prim.GetFilteredChildren(traversalPredicate()))
+        children.push_back(child);
+    }
+    subtrees.swap(children);
+  }
+
+  std::vector<Entries> entries(subtrees.size() + 1);
+  WorkParallelForN(subtrees.size() + 1, [this, &subtrees, &splitPrims, &entries](size_t begin, size_t end)
+  {
+    std::unordered_map<TfToken, bool, TfToken::HashFunctor> typeCache;
+    for(size_t i = begin; i < end; ++i)
+    {
+      auto indexPrim = [this, &typeCache, &entries, i](const UsdPrim& prim)
+      {
+        if(isSchemaPrim(prim, typeCache))
+          entries[i].m_schemaPrims.push_back(prim.GetPath());
+        if(prim.IsInstance())
+          entries[i].m_instances.emplace_back(prim.GetPath(), prim.GetMaster().GetPath());
+      };
+
+      if(i == subtrees.size())
+      {
+        for(const UsdPrim& prim : splitPrims)
+          indexPrim(prim);
+      }
+      else
+      {
+        for(const UsdPrim& prim : UsdPrimRange(subtrees[i], traversalPredicate()))
+          indexPrim(prim);
+      }
+    }
+  });
+
+  for(const Entries& e : entries)
+  {
+    m_schemaPrims.insert(e.m_schemaPrims.begin(), e.m_schemaPrims.end());
+    m_instances.insert(e.m_instances.begin(), e.m_instances.end());
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void SchemaPrimIndex::removeSubtree(const SdfPath& path)
+{
+  // descendants sort right after their ancestor
+  auto first = m_schemaPrims.lower_bound(path);
+  auto last = first;
+  while(last != m_schemaPrims.end() && last->HasPrefix(path))
+    ++last;
+  m_schemaPrims.erase(first, last);
+
+  auto firstInstance = m_instances.lower_bound(path);
+  auto lastInstance = firstInstance;
+  while(lastInstance != m_instances.end() && lastInstance->first.HasPrefix(path))
+    ++lastInstance;
+  m_instances.erase(firstInstance, lastInstance);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void SchemaPrimIndex::build(const UsdStageRefPtr& stage, fileio::translators::TranslatorManufacture& manufacture)
+{
+  TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("SchemaPrimIndex::build\n");
+  clear();
+
+  m_stage = stage;
+  m_manufacture = &manufacture;
+  m_pythonTranslatorsGeneration = translators::TranslatorManufacture::getPythonTranslatorsGeneration();
+  manufacture.getTranslatableTypes(m_schemaTypeNames, m_assetTypes);
+
+  std::vector<UsdPrim> roots = stage->GetMasters();
+  for(const UsdPrim& master : roots)
+    m_masters.push_back(master.GetPath());
+  roots.push_back(stage->GetPseudoRoot());
+  indexSubtrees(roots);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void SchemaPrimIndex::update(const UsdStageRefPtr& stage)
+{
+  if(m_resyncedPaths.empty() && m_changedPrimPaths.empty())
+    return;
+
+  TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("SchemaPrimIndex::update %zu resynced paths\n", m_resyncedPaths.size());
+
+  SdfPath::RemoveDescendentPaths(&m_resyncedPaths);
+
+  // Changes to the masters are reported on their instances, so index the masters again if instances are affected.
+  bool mastersChanged = false;
+  std::vector<UsdPrim> roots;
+  for(const SdfPath& path : m_resyncedPaths)
+  {
+    auto instance = m_instances.lower_bound(path);
+    mastersChanged = mastersChanged || (instance != m_instances.end() && instance->first.HasPrefix(path));
+    removeSubtree(path);
+
+    UsdPrim prim = stage->GetPrimAtPath(path);
+    if(prim)
+    {
+      roots.push_back(prim);
+    }
+  }
+  indexSubtrees(roots);
+
+  if(!mastersChanged)
+  {
+    for(const UsdPrim& prim : roots)
+    {
+      auto instance = m_instances.lower_bound(prim.GetPath());
+      mastersChanged = mastersChanged || (instance != m_instances.end() && instance->first.HasPrefix(prim.GetPath()));
+    }
+  }
+
+  if(mastersChanged)
+  {
+    for(const SdfPath& master : m_masters)
+      removeSubtree(master);
+    m_masters.clear();
+
+    std::vector<UsdPrim> masters = stage->GetMasters();
+    for(const UsdPrim& master : masters)
+      m_masters.push_back(master.GetPath());
+    indexSubtrees(masters);
+  }
+
+  std::unordered_map<TfToken, bool, TfToken::HashFunctor> typeCache;
+  for(const SdfPath& path : m_changedPrimPaths)
+  {
+    UsdPrim prim = stage->GetPrimAtPath(path);
+    if(prim && traversalPredicate()(prim) && isSchemaPrim(prim, typeCache))
+      m_schemaPrims.insert(path);
+    else
+      m_schemaPrims.erase(path);
+  }
+
+  m_resyncedPaths.clear();
+  m_changedPrimPaths.clear();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void SchemaPrimIndex::collect(
+    const UsdStageRefPtr& stage,
+    const SdfPath& startPath,
+    fileio::translators::TranslatorManufacture& manufacture,
+    bool importAll,
+    std::vector<UsdPrim>& prims) const
+{
+  // walk the schema prims and instances under the start path in order, and collect the schema prims of the master
+  // of each instance right after the instance itself
+  auto schemaPrim = m_schemaPrims.lower_bound(startPath);
+  auto instance = m_instances.lower_bound(startPath);
+  for(;;)
+  {
+    const bool hasSchemaPrim = schemaPrim != m_schemaPrims.end() && schemaPrim->HasPrefix(startPath);
+    const bool hasInstance = instance != m_instances.end() && instance->first.HasPrefix(startPath);
+    if(!hasSchemaPrim && !hasInstance)
+      break;
+
+    if(hasSchemaPrim && (!hasInstance || !(instance->first < *schemaPrim)))
+    {
+      UsdPrim prim = stage->GetPrimAtPath(*schemaPrim);
+      if(prim.IsValid())
+      {
+        translators::TranslatorRefPtr trans = manufacture.get(prim);
+        if(trans && (trans->importableByDefault() || importAll))
+        {
+          prims.push_back(prim);
+        }
+      }
+      ++schemaPrim;
+    }
+    else
+    {
+      collect(stage, instance->second, manufacture, importAll, prims);
+      ++instance;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+std::vector<UsdPrim> SchemaPrimIndex::findSchemaPrims(
+    const UsdPrim& startPrim,
+    fileio::translators::TranslatorManufacture& manufacture,
+    bool importAll)
+{
+  std::vector<UsdPrim> prims;
+  if(!startPrim.IsValid())
+    return prims;
+
+  UsdStageRefPtr stage = startPrim.GetStage();
+  if(m_stage != stage ||
+     m_manufacture != &manufacture ||
+     m_pythonTranslatorsGeneration != translators::TranslatorManufacture::getPythonTranslatorsGeneration())
+  {
+    build(stage, manufacture);
+  }
+  else
+  {
+    update(stage);
+  }
+
+  // like fileio::TransformIterator, a start prim which isn't traversed is still visited, but none of its descendants
+  if(!traversalPredicate()(startPrim))
+  {
+    translators::TranslatorRefPtr trans = manufacture.get(startPrim);
+    if(trans && (trans->importableByDefault() || importAll))
+      prims.push_back(startPrim);
+    return prims;
+  }
+
+  collect(stage, startPrim.GetPath(), manufacture, importAll, prims);
+  return prims;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 } // fileio
 } // usdmaya
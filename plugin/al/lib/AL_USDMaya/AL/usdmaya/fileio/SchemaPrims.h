@@ -23,6 +23,14 @@
 
 #include <pxr/pxr.h>
 #include <pxr/base/tf/token.h>
+#include <pxr/usd/usd/notice.h>
+
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
@@ -80,6 +88,85 @@ private:
   fileio::translators::TranslatorManufacture& m_manufacture;
 };
 
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  an index of the prims of a stage for which a translator is registered, so that finding the prims to
+///         import under a path is a range query rather than a traversal of all the prims under it.
+///
+///         The index is built in parallel on first use, and kept up to date from the ObjectsChanged notices of the
+///         stage passed to processChangedObjects(): resynced subtrees are indexed again the next time the index is
+///         queried. It is rebuilt when the stage, the translator registry or the python translators change.
+///         Translators may be activated or deactivated at any time, this is checked when querying.
+/// \ingroup   fileio
+//----------------------------------------------------------------------------------------------------------------------
+class SchemaPrimIndex
+{
+public:
+
+  /// \brief  ctor
+  AL_USDMAYA_PUBLIC
+  SchemaPrimIndex();
+
+  /// \brief  dtor
+  AL_USDMAYA_PUBLIC
+  ~SchemaPrimIndex();
+
+  /// \brief  returns the prims with an active translator from the start prim down, following instances into
+  ///         their masters like fileio::TransformIterator does. Parents are returned before their descendants.
+  /// \param  startPrim the prim from which to search
+  /// \param  manufacture the translator registry
+  /// \param  importAll if false, only the prims whose translator imports by default are returned
+  /// \return the prims to import
+  AL_USDMAYA_PUBLIC
+  std::vector<UsdPrim> findSchemaPrims(
+      const UsdPrim& startPrim,
+      fileio::translators::TranslatorManufacture& manufacture,
+      bool importAll);
+
+  /// \brief  records the changes of a stage notice. The owner of the index must call it for every ObjectsChanged
+  ///         notice, before querying the index in response to the notice.
+  /// \param  notice the notice
+  /// \param  sender the stage that sent the notice, notices of other stages than the indexed one are ignored
+  AL_USDMAYA_PUBLIC
+  void processChangedObjects(UsdNotice::ObjectsChanged const& notice, UsdStageWeakPtr const& sender);
+
+  /// \brief  drops the index, it will be rebuilt on next query
+  AL_USDMAYA_PUBLIC
+  void clear();
+
+private:
+  struct Entries
+  {
+    SdfPathVector m_schemaPrims;
+    std::vector<std::pair<SdfPath, SdfPath>> m_instances;
+  };
+
+  void build(const UsdStageRefPtr& stage, fileio::translators::TranslatorManufacture& manufacture);
+  void update(const UsdStageRefPtr& stage);
+  void indexSubtrees(const std::vector<UsdPrim>& roots);
+  void removeSubtree(const SdfPath& path);
+  bool isSchemaPrim(const UsdPrim& prim, std::unordered_map<TfToken, bool, TfToken::HashFunctor>& typeCache) const;
+  void collect(
+      const UsdStageRefPtr& stage,
+      const SdfPath& startPath,
+      fileio::translators::TranslatorManufacture& manufacture,
+      bool importAll,
+      std::vector<UsdPrim>& prims) const;
+
+  UsdStageWeakPtr m_stage;
+  fileio::translators::TranslatorManufacture* m_manufacture = nullptr;
+  size_t m_pythonTranslatorsGeneration = 0;
+
+  std::unordered_set<std::string> m_schemaTypeNames;
+  std::unordered_set<std::string> m_assetTypes;
+
+  std::set<SdfPath> m_schemaPrims;
+  std::map<SdfPath, SdfPath> m_instances; ///< instance prims to their master
+  SdfPathVector m_masters;
+
+  SdfPathVector m_resyncedPaths;
+  SdfPathVector m_changedPrimPaths;
+};
+
 
 //----------------------------------------------------------------------------------------------------------------------
 } // fileio
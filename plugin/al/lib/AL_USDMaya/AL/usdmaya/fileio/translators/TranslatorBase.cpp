@@ -29,6 +29,7 @@ namespace translators {
 
 std::vector<TranslatorRefPtr > TranslatorManufacture::m_pythonTranslators;
 std::unordered_map<std::string, TranslatorRefPtr> TranslatorManufacture::m_assetTypeToPythonTranslatorsMap;
+size_t TranslatorManufacture::m_pythonTranslatorsGeneration = 1;
 
 TfToken TranslatorManufacture::TranslatorPrefixAssetType("assettype:");
 TfToken TranslatorManufacture::TranslatorPrefixSchemaType("schematype:");
@@ -141,26 +142,60 @@ TranslatorManufacture::RefPtr TranslatorManufacture::getTranslatorByAssetTypeMet
 //----------------------------------------------------------------------------------------------------------------------
 TranslatorRefPtr TranslatorManufacture::getTranslatorBySchemaType(const TfToken type_name)
 {
-  if(auto py = getPythonTranslatorBySchemaType(type_name))
+  // the schema type and C++ translator of a type name never change, python translators can be added or removed
+  auto inserted = m_schemaTypeTranslators.emplace(type_name, SchemaTypeTranslators());
+  SchemaTypeTranslators& translators = inserted.first->second;
+  if(inserted.second)
   {
-    return py;
+    translators.m_type = TfType::FindDerivedByName<UsdSchemaBase>(type_name);
+    const std::string& typeName = translators.m_type.GetTypeName();
+    TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("TranslatorManufacture::getTranslatorBySchemaType:: found schema %s\n",typeName.c_str());
+
+    //Look it up in our map of translators
+    auto it = m_translatorsMap.find(typeName);
+    if (it != m_translatorsMap.end())
+    {
+      translators.m_cpp = it->second;
+    }
   }
 
-  TfType type = TfType::FindDerivedByName<UsdSchemaBase>(type_name);
-  std::string typeName(type.GetTypeName());
-  TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("TranslatorManufacture::getTranslatorBySchemaType:: found schema %s\n",typeName.c_str());
+  if(translators.m_pythonTranslatorsGeneration != m_pythonTranslatorsGeneration)
+  {
+    translators.m_python = getPythonTranslatorBySchemaType(type_name);
+    translators.m_pythonTranslatorsGeneration = m_pythonTranslatorsGeneration;
+  }
+
+  if(translators.m_python)
+  {
+    return translators.m_python;
+  }
 
-  //Look it up in our map of translators
-  auto it = m_translatorsMap.find(typeName);
-  if (it != m_translatorsMap.end())
+  if(translators.m_cpp && translators.m_cpp->active())
   {
-    if(it->second->active())
+    TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("TranslatorManufacture::getTranslatorBySchemaType:: found active C++ translator for schema %s\n",translators.m_type.GetTypeName().c_str());
+    return translators.m_cpp;
+  }
+  return TranslatorRefPtr();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void TranslatorManufacture::getTranslatableTypes(std::unordered_set<std::string>& schemaTypeNames, std::unordered_set<std::string>& assetTypes)
+{
+  for(const auto& it : m_translatorsMap)
+  {
+    schemaTypeNames.insert(it.first);
+  }
+  for(const auto& it : m_pythonTranslators)
+  {
+    if(it->getRegistrationType() == TranslatorManufacture::TranslatorPrefixSchemaType)
     {
-      TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("TranslatorManufacture::getTranslatorBySchemaType:: found active C++ translator for schema %s\n",typeName.c_str());
-      return it->second;
+      schemaTypeNames.insert(it->getTranslatedType().GetTypeName());
     }
   }
-  return TranslatorRefPtr();
+  for(const auto& it : m_assetTypeToPythonTranslatorsMap)
+  {
+    assetTypes.insert(it.first);
+  }
 }
 
 
@@ -347,6 +382,7 @@ bool TranslatorManufacture::addPythonTranslator(TranslatorRefPtr tb, const TfTok
   TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("TranslatorManufacture::addPythonTranslator\n");
   tb->initialize();
   m_pythonTranslators.push_back(tb);
+  ++m_pythonTranslatorsGeneration;
   if(!assetType.IsEmpty())
   {
     m_assetTypeToPythonTranslatorsMap.emplace(assetType.GetString(), tb);
@@ -366,6 +402,7 @@ void TranslatorManufacture::clearPythonTranslators()
 {
   m_pythonTranslators.clear();
   m_assetTypeToPythonTranslatorsMap.clear();
+  ++m_pythonTranslatorsGeneration;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -422,6 +459,7 @@ bool TranslatorManufacture::deletePythonTranslator(const TfType type_name)
     if(type_name == thetype)
     {
       TranslatorManufacture::m_pythonTranslators.erase(it);
+      ++m_pythonTranslatorsGeneration;
       return true;
     }
   }
@@ -459,6 +497,12 @@ std::vector<TranslatorRefPtr> TranslatorManufacture::getPythonTranslators()
   return m_pythonTranslators;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+size_t TranslatorManufacture::getPythonTranslatorsGeneration()
+{
+  return m_pythonTranslatorsGeneration;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 TF_REGISTRY_FUNCTION(TfType)
 {
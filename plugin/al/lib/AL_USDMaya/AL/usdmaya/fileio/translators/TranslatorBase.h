@@ -32,6 +32,7 @@
 #include <functional>
 #include <iostream>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace AL {
 namespace usdmaya {
@@ -422,6 +423,19 @@ public:
   AL_USDMAYA_PUBLIC
   static std::vector<TranslatorRefPtr> getPythonTranslators();
 
+  /// \brief  returns a counter incremented whenever python translators are added or removed, so that data
+  ///         derived from the registered translators can be invalidated.
+  /// \return the python translators generation
+  AL_USDMAYA_PUBLIC
+  static size_t getPythonTranslatorsGeneration();
+
+  /// \brief  gathers the types for which a translator is registered, whether active or not. Unlike get(), the
+  ///         returned sets can be queried concurrently, e.g. to find the translatable prims of a stage in parallel.
+  /// \param  schemaTypeNames receives the TfType names of the schemas with a translator
+  /// \param  assetTypes receives the assettype metadata values with a translator
+  AL_USDMAYA_PUBLIC
+  void getTranslatableTypes(std::unordered_set<std::string>& schemaTypeNames, std::unordered_set<std::string>& assetTypes);
+
 private:
   /// \brief  returns a translator for the specified schema
   /// \param  type_name the schema name
@@ -439,7 +453,19 @@ private:
   /// \return returns the python translator (if one is available)
   static TranslatorRefPtr getPythonTranslatorBySchemaType(const TfToken type_name);
 
+  /// the translators found for a prim type name, which avoids looking up the schema TfType and the
+  /// translators for every prim
+  struct SchemaTypeTranslators
+  {
+    TranslatorRefPtr m_cpp;
+    TranslatorRefPtr m_python;
+    TfType m_type;
+    size_t m_pythonTranslatorsGeneration = 0;
+  };
+
   std::unordered_map<std::string, TranslatorRefPtr> m_translatorsMap;
+  std::unordered_map<TfToken, SchemaTypeTranslators, TfToken::HashFunctor> m_schemaTypeTranslators;
+  static size_t m_pythonTranslatorsGeneration;
   static std::unordered_map<std::string, TranslatorRefPtr> m_assetTypeToPythonTranslatorsMap;
   std::vector<ExtraDataPluginPtr> m_extraDataPlugins;
   static TranslatorRefPtrVector m_pythonTranslators;
@@ -40,8 +40,27 @@ namespace AL {
 namespace usdmaya {
 namespace nodes {
 
-Engine::Engine(const SdfPath& rootPath, const SdfPathVector& excludedPaths)
-  : UsdImagingGLEngine(rootPath, excludedPaths) {}
+Engine::Engine(const SdfPath& rootPath, const SdfPathVector& excludedPaths, const SdfPathVector& invisedPaths)
+  : UsdImagingGLEngine(rootPath, excludedPaths, invisedPaths) {}
+
+bool Engine::SetInvisedPrimPaths(const SdfPathVector& invisedPaths) {
+  if (ARCH_UNLIKELY(_legacyImpl)) {
+    return false;
+  }
+
+  // The paths are handed to the delegate when it gets populated.
+  _invisedPrimPaths = invisedPaths;
+  if (!_isPopulated) {
+    return true;
+  }
+
+#if defined(USDIMAGINGGL_API_VERSION) && USDIMAGINGGL_API_VERSION >= 5
+  _GetSceneDelegate()->SetInvisedPrimPaths(invisedPaths);
+#else
+  _delegate->SetInvisedPrimPaths(invisedPaths);
+#endif
+  return true;
+}
 
 bool Engine::TestIntersectionBatch(
   const GfMatrix4d &viewMatrix,
@@ -27,7 +27,16 @@ namespace nodes {
 class Engine : public UsdImagingGLEngine {
 public:
   Engine(const SdfPath& rootPath,
-         const SdfPathVector& excludedPaths);
+         const SdfPathVector& excludedPaths,
+         const SdfPathVector& invisedPaths = SdfPathVector());
+
+  /// \brief  Replace the paths hidden from the render. Unlike excluded paths, which are never populated,
+  ///         invised paths can change without repopulating the scene delegate: the render index and its
+  ///         GPU resources are kept, and only the subtrees that changed visibility are dirtied.
+  /// \param  invisedPaths the prim paths to hide
+  /// \return false if the engine can't update them in place (legacy GL implementation), in which case it
+  ///         has to be reconstructed
+  bool SetInvisedPrimPaths(const SdfPathVector& invisedPaths);
 
   struct HitInfo {
     GfVec3d worldSpaceHitPoint;
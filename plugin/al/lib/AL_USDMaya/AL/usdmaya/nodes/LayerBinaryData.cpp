@@ -0,0 +1,234 @@
+//
+// Copyright 2017 Animal Logic
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "AL/usdmaya/DebugCodes.h"
+#include "AL/usdmaya/TypeIDs.h"
+#include "AL/usdmaya/nodes/LayerBinaryData.h"
+
+#include <pxr/base/arch/fileSystem.h>
+
+#include <maya/MArgList.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+namespace AL {
+namespace usdmaya {
+namespace nodes {
+
+namespace {
+
+const char* const kBase64Chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+std::string encodeBase64(const std::string& input)
+{
+  std::string output;
+  output.reserve(((input.size() + 2) / 3) * 4);
+  const unsigned char* data = reinterpret_cast<const unsigned char*>(input.data());
+  size_t i = 0;
+  for(const size_t n = input.size(); i + 2 < n; i += 3)
+  {
+    const uint32_t v = (uint32_t(data[i]) << 16) | (uint32_t(data[i + 1]) << 8) | uint32_t(data[i + 2]);
+    output.push_back(kBase64Chars[(v >> 18) & 0x3F]);
+    output.push_back(kBase64Chars[(v >> 12) & 0x3F]);
+    output.push_back(kBase64Chars[(v >> 6) & 0x3F]);
+    output.push_back(kBase64Chars[v & 0x3F]);
+  }
+  const size_t remaining = input.size() - i;
+  if(remaining)
+  {
+    uint32_t v = uint32_t(data[i]) << 16;
+    if(remaining == 2)
+      v |= uint32_t(data[i + 1]) << 8;
+    output.push_back(kBase64Chars[(v >> 18) & 0x3F]);
+    output.push_back(kBase64Chars[(v >> 12) & 0x3F]);
+    output.push_back(remaining == 2 ? kBase64Chars[(v >> 6) & 0x3F] : '=');
+    output.push_back('=');
+  }
+  return output;
+}
+
+bool decodeBase64(const char* input, size_t length, std::string& output)
+{
+  int8_t lookup[256];
+  std::fill(lookup, lookup + 256, int8_t(-1));
+  for(int i = 0; i < 64; ++i)
+  {
+    lookup[uint8_t(kBase64Chars[i])] = int8_t(i);
+  }
+
+  output.clear();
+  output.reserve((length / 4) * 3);
+  uint32_t v = 0;
+  int bits = 0;
+  for(size_t i = 0; i < length; ++i)
+  {
+    const char c = input[i];
+    if(c == '=')
+      break;
+    const int8_t d = lookup[uint8_t(c)];
+    if(d < 0)
+      return false;
+    v = (v << 6) | uint32_t(d);
+    bits += 6;
+    if(bits >= 8)
+    {
+      bits -= 8;
+      output.push_back(char((v >> bits) & 0xFF));
+    }
+  }
+  return true;
+}
+
+/// writes the bytes to a temporary crate file, returning its path
+std::string writeTemporaryCrate(const std::string& bytes)
+{
+  const std::string path = ArchMakeTmpFileName("AL_usdmaya_layer", ".usdc");
+  std::ofstream out(path, std::ios::binary);
+  out.write(bytes.data(), bytes.size());
+  return out.good() ? path : std::string();
+}
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------------------------------------------------
+const MTypeId LayerBinaryData::mayaTypeId(AL_USDMAYA_LAYERBINARYDATA);
+const MString LayerBinaryData::typeName("AL_usdmaya_LayerBinaryData");
+
+//----------------------------------------------------------------------------------------------------------------------
+void* LayerBinaryData::creator()
+{
+  return new LayerBinaryData;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+LayerBinaryData::Bytes LayerBinaryData::serialise(const SdfLayerHandle& layer)
+{
+  // Sdf can only write the crate format to files, so go through a temporary one
+  const std::string path = ArchMakeTmpFileName("AL_usdmaya_layer", ".usdc");
+  if(!layer || !layer->Export(path))
+  {
+    ArchUnlinkFile(path.c_str());
+    return Bytes();
+  }
+
+  std::ifstream in(path, std::ios::binary);
+  auto bytes = std::make_shared<std::string>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  in.close();
+  ArchUnlinkFile(path.c_str());
+
+  TF_DEBUG(ALUSDMAYA_LAYERS).Msg("LayerBinaryData::serialise %s (%zu bytes)\n",
+                                 layer->GetIdentifier().c_str(), bytes->size());
+  return bytes;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool LayerBinaryData::deserialise(const std::string& bytes, const SdfLayerHandle& layer)
+{
+  const std::string path = writeTemporaryCrate(bytes);
+  if(path.empty() || !layer)
+  {
+    return false;
+  }
+
+  bool result = false;
+  {
+    SdfLayerRefPtr crateLayer = SdfLayer::OpenAsAnonymous(path);
+    if(crateLayer)
+    {
+      // TransferContent copies the data, so the temporary file is no longer needed after this
+      layer->TransferContent(crateLayer);
+      result = true;
+    }
+  }
+  ArchUnlinkFile(path.c_str());
+  return result;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+MStatus LayerBinaryData::readASCII(const MArgList& argList, unsigned& endOfTheLastParsedElement)
+{
+  MStatus status;
+  const MString encoded = argList.asString(endOfTheLastParsedElement++, &status);
+  if(!status)
+  {
+    return status;
+  }
+  auto bytes = std::make_shared<std::string>();
+  if(!decodeBase64(encoded.asChar(), encoded.length(), *bytes))
+  {
+    return MS::kFailure;
+  }
+  m_bytes = bytes;
+  return MS::kSuccess;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+MStatus LayerBinaryData::readBinary(std::istream& in, unsigned length)
+{
+  auto bytes = std::make_shared<std::string>(length, '\0');
+  if(length && !in.read(&(*bytes)[0], length))
+  {
+    return MS::kFailure;
+  }
+  m_bytes = bytes;
+  return MS::kSuccess;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+MStatus LayerBinaryData::writeASCII(std::ostream& out)
+{
+  out << '"' << (m_bytes ? encodeBase64(*m_bytes) : std::string()) << '"';
+  return out.fail() ? MS::kFailure : MS::kSuccess;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+MStatus LayerBinaryData::writeBinary(std::ostream& out)
+{
+  if(m_bytes)
+  {
+    out.write(m_bytes->data(), m_bytes->size());
+  }
+  return out.fail() ? MS::kFailure : MS::kSuccess;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void LayerBinaryData::copy(const MPxData& src)
+{
+  const LayerBinaryData* data = dynamic_cast<const LayerBinaryData*>(&src);
+  if(data)
+  {
+    m_bytes = data->m_bytes;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+MTypeId LayerBinaryData::typeId() const
+{
+  return mayaTypeId;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+MString LayerBinaryData::name() const
+{
+  return typeName;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+} // nodes
+} // usdmaya
+} // AL
+//----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,104 @@
+//
+// Copyright 2017 Animal Logic
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#pragma once
+
+#include "AL/usdmaya/Api.h"
+
+#include <maya/MPxData.h>
+#include <maya/MString.h>
+#include <maya/MTypeId.h>
+
+#include <pxr/usd/sdf/layer.h>
+
+#include <memory>
+#include <string>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace AL {
+namespace usdmaya {
+namespace nodes {
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  Maya data object holding a layer serialised in the USD crate (binary) format. It is written as raw bytes
+///         into Maya binary files, and base64 encoded into Maya ascii files.
+///         The bytes are shared between copies of the data, so storing a cached serialisation on a plug is cheap.
+/// \ingroup nodes
+//----------------------------------------------------------------------------------------------------------------------
+class LayerBinaryData
+  : public MPxData
+{
+public:
+  typedef std::shared_ptr<const std::string> Bytes;
+
+  /// \brief  the type id of this data type
+  AL_USDMAYA_PUBLIC
+  static const MTypeId mayaTypeId;
+
+  /// \brief  the type name of this data type
+  AL_USDMAYA_PUBLIC
+  static const MString typeName;
+
+  /// \brief  creates an instance of this data type
+  AL_USDMAYA_PUBLIC
+  static void* creator();
+
+  /// \brief  serialises the given layer into crate format
+  /// \param  layer the layer to serialise
+  /// \return the serialised bytes, or nullptr on failure
+  AL_USDMAYA_PUBLIC
+  static Bytes serialise(const SdfLayerHandle& layer);
+
+  /// \brief  replaces the contents of the given layer with the contents stored in crate format
+  /// \param  bytes the serialised layer
+  /// \param  layer the layer that will receive the contents
+  /// \return true on success
+  AL_USDMAYA_PUBLIC
+  static bool deserialise(const std::string& bytes, const SdfLayerHandle& layer);
+
+  /// \brief  returns the stored bytes
+  inline const Bytes& bytes() const
+    { return m_bytes; }
+
+  /// \brief  sets the stored bytes
+  inline void setBytes(const Bytes& bytes)
+    { m_bytes = bytes; }
+
+  /// \brief  returns true if no bytes are stored
+  inline bool empty() const
+    { return !m_bytes || m_bytes->empty(); }
+
+  //--------------------------------------------------------------------------------------------------------------------
+  /// MPxData overrides
+  //--------------------------------------------------------------------------------------------------------------------
+
+  MStatus readASCII(const MArgList& argList, unsigned& endOfTheLastParsedElement) override;
+  MStatus readBinary(std::istream& in, unsigned length) override;
+  MStatus writeASCII(std::ostream& out) override;
+  MStatus writeBinary(std::ostream& out) override;
+  void copy(const MPxData& src) override;
+  MTypeId typeId() const override;
+  MString name() const override;
+
+private:
+  Bytes m_bytes;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+} // nodes
+} // usdmaya
+} // AL
+//----------------------------------------------------------------------------------------------------------------------
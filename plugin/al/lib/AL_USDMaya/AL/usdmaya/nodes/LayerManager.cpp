@@ -19,6 +19,7 @@
 #include "AL/usdmaya/TypeIDs.h"
 #include "AL/usdmaya/nodes/LayerManager.h"
 
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/sdf/textFileFormat.h>
 #include <pxr/usd/usd/usdaFileFormat.h>
 #include <pxr/usd/usd/usdcFileFormat.h>
@@ -27,6 +28,7 @@
 #include <maya/MArrayDataBuilder.h>
 #include <maya/MDGModifier.h>
 #include <maya/MFnDependencyNode.h>
+#include <maya/MFnPluginData.h>
 #include <maya/MGlobal.h>
 #include <maya/MItDependencyNodes.h>
 #include <maya/MPlugArray.h>
@@ -240,6 +242,64 @@ void LayerDatabase::_addLayer(SdfLayerRefPtr layer, const std::string& identifie
   idsForLayer.push_back(identifier);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+LayerSerialisationCache::LayerSerialisationCache()
+{
+  TfWeakPtr<LayerSerialisationCache> self(this);
+  m_noticeKey = TfNotice::Register(self, &LayerSerialisationCache::onLayersDidChange);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+LayerSerialisationCache::~LayerSerialisationCache()
+{
+  TfNotice::Revoke(m_noticeKey);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+LayerBinaryData::Bytes LayerSerialisationCache::find(const SdfLayerHandle& layer) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_entries.find(get_pointer(layer));
+  // the handle guards against a new layer allocated at the address of a deleted one
+  if(it != m_entries.end() && it->second.layer == layer)
+  {
+    return it->second.bytes;
+  }
+  return LayerBinaryData::Bytes();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void LayerSerialisationCache::insert(const SdfLayerHandle& layer, const LayerBinaryData::Bytes& bytes)
+{
+  if(!layer || !bytes)
+    return;
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries[get_pointer(layer)] = Entry{layer, bytes};
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void LayerSerialisationCache::erase(const SdfLayerHandle& layer)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries.erase(get_pointer(layer));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void LayerSerialisationCache::onLayersDidChange(const SdfNotice::LayersDidChange& notice)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if(m_entries.empty())
+    return;
+#if USD_VERSION_NUM > 1911
+  for(const auto& layerChanges : notice.GetChangeListVec())
+#else
+  for(const auto& layerChanges : notice.GetChangeListMap())
+#endif
+  {
+    m_entries.erase(get_pointer(layerChanges.first));
+  }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 AL_MAYA_DEFINE_NODE(LayerManager, AL_USDMAYA_LAYERMANAGER, AL_usdmaya);
 
@@ -247,6 +307,7 @@ AL_MAYA_DEFINE_NODE(LayerManager, AL_USDMAYA_LAYERMANAGER, AL_usdmaya);
 MObject LayerManager::m_layers = MObject::kNullObj;
 MObject LayerManager::m_identifier = MObject::kNullObj;
 MObject LayerManager::m_serialized = MObject::kNullObj;
+MObject LayerManager::m_serializedBinary = MObject::kNullObj;
 MObject LayerManager::m_anonymous = MObject::kNullObj;
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -278,10 +339,11 @@ MStatus LayerManager::initialise()
     // add attributes to store the serialization info
     m_identifier = addStringAttr("identifier", "id", kCached | kReadable | kStorable | kHidden);
     m_serialized = addStringAttr("serialized", "szd", kCached | kReadable | kStorable | kHidden);
+    m_serializedBinary = addDataAttr("serializedBinary", "szb", LayerBinaryData::mayaTypeId, kCached | kReadable | kStorable | kHidden);
     m_anonymous = addBoolAttr("anonymous", "ann", false, kCached | kReadable | kStorable | kHidden);
     m_layers = addCompoundAttr("layers", "lyr",
         kCached | kReadable | kWritable | kStorable | kConnectable | kHidden | kArray | kUsesArrayDataBuilder,
-        {m_identifier, m_serialized, m_anonymous});
+        {m_identifier, m_serialized, m_serializedBinary, m_anonymous});
   }
   catch(const MStatus& status)
   {
@@ -385,6 +447,7 @@ bool LayerManager::removeLayer(SdfLayerHandle layer)
     MGlobal::displayError("LayerManager::removeLayer - given layer is no longer valid");
     return false;
   }
+  m_serialisationCache.erase(layer);
   boost::unique_lock<boost::shared_mutex> lock(m_layersMutex);
   return m_layerDatabase.removeLayer(layerRef);
 }
@@ -427,17 +490,53 @@ MStatus LayerManager::populateSerialisationAttributes()
     boost::shared_lock_guard<boost::shared_mutex> lock(m_layersMutex);
     MArrayDataBuilder builder(&dataBlock, layers(), m_layerDatabase.max_size(), &status);
     AL_MAYA_CHECK_ERROR(status, errorString);
-    std::string temp;
+
+    // Reuse the data written by the previous save for unchanged layers, and serialise the others in parallel
+    std::vector<SdfLayerHandle> layerHandles;
+    std::vector<LayerBinaryData::Bytes> layerBytes;
     for (const auto& layerAndIds : m_layerDatabase)
     {
-      auto& layer = layerAndIds.first;
+      layerHandles.push_back(layerAndIds.first);
+      layerBytes.push_back(m_serialisationCache.find(layerAndIds.first));
+    }
+    WorkParallelForN(layerHandles.size(), [&layerHandles, &layerBytes](size_t begin, size_t end)
+    {
+      for (size_t i = begin; i < end; ++i)
+      {
+        if (!layerBytes[i])
+        {
+          layerBytes[i] = LayerBinaryData::serialise(layerHandles[i]);
+        }
+      }
+    });
+
+    std::string temp;
+    for (size_t i = 0, n = layerHandles.size(); i < n; ++i)
+    {
+      auto& layer = layerHandles[i];
       MDataHandle layersElemHandle = builder.addLast(&status);
       AL_MAYA_CHECK_ERROR(status, errorString);
       MDataHandle idHandle = layersElemHandle.child(m_identifier);
       idHandle.setString(AL::maya::utils::convert(layer->GetIdentifier()));
       MDataHandle serializedHandle = layersElemHandle.child(m_serialized);
-      layer->ExportToString(&temp);
-      serializedHandle.setString(AL::maya::utils::convert(temp));
+      if (layerBytes[i])
+      {
+        m_serialisationCache.insert(layer, layerBytes[i]);
+        MObject data;
+        LayerBinaryData* binaryData = createData<LayerBinaryData>(LayerBinaryData::mayaTypeId, data);
+        AL_MAYA_CHECK_ERROR(binaryData ? MS::kSuccess : MS::kFailure, errorString);
+        binaryData->setBytes(layerBytes[i]);
+        layersElemHandle.child(m_serializedBinary).setMObject(data);
+        serializedHandle.setString(MString());
+      }
+      else
+      {
+        // fall back to the text format if the layer could not be written as crate
+        TF_DEBUG(ALUSDMAYA_LAYERS).Msg("LayerManager::populateSerialisationAttributes falling back to usda for %s\n",
+                                       layer->GetIdentifier().c_str());
+        layer->ExportToString(&temp);
+        serializedHandle.setString(AL::maya::utils::convert(temp));
+      }
       MDataHandle anonHandle = layersElemHandle.child(m_anonymous);
       anonHandle.setBool(layer->IsAnonymous());
     }
@@ -483,6 +582,7 @@ void LayerManager::loadAllLayers()
   MPlug idPlug;
   MPlug anonymousPlug;
   MPlug serializedPlug;
+  MPlug serializedBinaryPlug;
   std::string identifierVal;
   std::string serializedVal;
   SdfLayerRefPtr layer;
@@ -499,6 +599,8 @@ void LayerManager::loadAllLayers()
     AL_MAYA_CHECK_ERROR_CONTINUE(status, errorString);
     serializedPlug = singleLayerPlug.child(m_serialized, &status);
     AL_MAYA_CHECK_ERROR_CONTINUE(status, errorString);
+    serializedBinaryPlug = singleLayerPlug.child(m_serializedBinary, &status);
+    AL_MAYA_CHECK_ERROR_CONTINUE(status, errorString);
 
     identifierVal = idPlug.asString(MDGContext::fsNormal, &status).asChar();
     AL_MAYA_CHECK_ERROR_CONTINUE(status, errorString);
@@ -507,9 +609,19 @@ void LayerManager::loadAllLayers()
       MGlobal::displayError(MString("Error - plug ") + idPlug.partialName(true) + "had empty identifier");
       continue;
     }
+    // Files saved by older versions only hold the usda text
+    LayerBinaryData::Bytes serializedBytes;
+    {
+      MFnPluginData fnData(serializedBinaryPlug.asMObject(MDGContext::fsNormal));
+      const LayerBinaryData* binaryData = dynamic_cast<const LayerBinaryData*>(fnData.constData());
+      if(binaryData && !binaryData->empty())
+      {
+        serializedBytes = binaryData->bytes();
+      }
+    }
     serializedVal = serializedPlug.asString(MDGContext::fsNormal, &status).asChar();
     AL_MAYA_CHECK_ERROR_CONTINUE(status, errorString);
-    if(serializedVal.empty())
+    if(!serializedBytes && serializedVal.empty())
     {
       MGlobal::displayError(MString("Error - plug ") + serializedPlug.partialName(true) + "had empty serialization");
       continue;
@@ -536,7 +648,7 @@ void LayerManager::loadAllLayers()
         // an error. This seems unlikely, but we have a discussion with Pixar to find a way to avoid this.
 
         SdfFileFormatConstPtr fileFormat;
-        if(TfStringStartsWith(serializedVal, "#usda "))
+        if(serializedBytes || TfStringStartsWith(serializedVal, "#usda "))
         {
           // In order to make the layer reloadable by SdfLayer::Reload(), we need the
           // correct file format from identifier.
@@ -583,7 +695,19 @@ void LayerManager::loadAllLayers()
         layer->GetFileFormat()->GetFormatId().GetText()
         );
 
-    if(!layer->ImportFromString(serializedVal))
+    if(serializedBytes)
+    {
+      if(!LayerBinaryData::deserialise(*serializedBytes, layer))
+      {
+        TF_DEBUG(ALUSDMAYA_LAYERS).Msg("Import result: failed!\n"
+                                      "################################################\n");
+        MGlobal::displayError(MString("Failed to import serialized layer: ") + identifierVal.c_str());
+        continue;
+      }
+      // the layer now matches the stored data, so it does not need serialising on the next save unless edited
+      m_serialisationCache.insert(layer, serializedBytes);
+    }
+    else if(!layer->ImportFromString(serializedVal))
     {
       TF_DEBUG(ALUSDMAYA_LAYERS).Msg("Import result: failed!\n"
                                     "################################################\n");
@@ -19,12 +19,16 @@
 
 #include "AL/maya/utils/MayaHelperMacros.h"
 #include "AL/maya/utils/NodeHelper.h"
+#include "AL/usdmaya/nodes/LayerBinaryData.h"
 
 #include <maya/MPxNode.h>
 
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/usd/sdf/notice.h>
 #include <pxr/usd/usd/stage.h>
 
 #include <map>
+#include <mutex>
 #include <set>
 
 // On Windows, against certain versions of Maya and with strict compiler
@@ -234,6 +238,51 @@ private:
   IdToLayerMap m_idToLayer;
 };
 
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  Keeps the crate serialisation of layers written by previous scene saves, so that layers whose contents have
+///         not changed since then are not serialised again. An entry is discarded as soon as its layer changes.
+/// \ingroup nodes
+//----------------------------------------------------------------------------------------------------------------------
+class LayerSerialisationCache
+  : public TfWeakBase
+{
+public:
+  /// \brief  ctor, starts listening to layer changes
+  LayerSerialisationCache();
+
+  /// \brief  dtor
+  ~LayerSerialisationCache();
+
+  /// \brief  Find the serialisation of the given layer
+  /// \param  layer the layer to look up
+  /// \return the cached bytes, or nullptr if the layer changed since they were stored
+  LayerBinaryData::Bytes find(const SdfLayerHandle& layer) const;
+
+  /// \brief  Store the serialisation of the given layer
+  /// \param  layer the serialised layer
+  /// \param  bytes the crate data matching current layer contents
+  void insert(const SdfLayerHandle& layer, const LayerBinaryData::Bytes& bytes);
+
+  /// \brief  Discard the serialisation of the given layer
+  /// \param  layer the layer to discard
+  void erase(const SdfLayerHandle& layer);
+
+private:
+  LayerSerialisationCache(const LayerSerialisationCache&) = delete;
+  LayerSerialisationCache& operator=(const LayerSerialisationCache&) = delete;
+
+  void onLayersDidChange(const SdfNotice::LayersDidChange& notice);
+
+  struct Entry
+  {
+    SdfLayerHandle layer;
+    LayerBinaryData::Bytes bytes;
+  };
+  mutable std::mutex m_mutex;
+  std::map<const SdfLayer*, Entry> m_entries;
+  TfNotice::Key m_noticeKey;
+};
+
 //----------------------------------------------------------------------------------------------------------------------
 /// \brief  The layer manager node handles serialization and deserialization of all layers used by all ProxyShapes
 ///         It may temporarily contain non-dirty layers, but those will be filtered out by query operations.
@@ -314,6 +363,8 @@ public:
   void getLayerIdentifiers(MStringArray& outputNames);
 
   /// \brief  Ensures that the layers attribute will be filled out with serialized versions of all tracked layers.
+  ///         Layers are stored in crate format, layers which did not change since the previous save reuse the
+  ///         data written then, and the remaining ones are serialised in parallel.
   AL_USDMAYA_PUBLIC
   MStatus populateSerialisationAttributes();
 
@@ -321,7 +372,8 @@ public:
   AL_USDMAYA_PUBLIC
   MStatus clearSerialisationAttributes();
 
-  /// \brief  For every serialized layer stored in attributes, loads them as sdf layers
+  /// \brief  For every serialized layer stored in attributes, loads them as sdf layers. Both the crate data and the
+  ///         text (usda) strings written by older versions are supported.
   AL_USDMAYA_PUBLIC
   void loadAllLayers();
 
@@ -353,12 +405,14 @@ public:
   // the "identifierPlug" name is confusing
   AL_DECL_MULTI_CHILD_ATTRIBUTE(identifier);
   AL_DECL_MULTI_CHILD_ATTRIBUTE(serialized);
+  AL_DECL_MULTI_CHILD_ATTRIBUTE(serializedBinary);
   AL_DECL_MULTI_CHILD_ATTRIBUTE(anonymous);
 
 private:
   static MObject _findNode();
 
   LayerDatabase m_layerDatabase;
+  LayerSerialisationCache m_serialisationCache;
 
   // Note on layerManager / multithreading:
   // I don't know that layerManager will be used in a multihreaded manenr... but I also don't know it COULDN'T be.
@@ -378,6 +432,10 @@ private:
   /// \brief  access the serialized attribute handle
   /// \return the handle to the serialized attribute
 
+  /// \var    static MObject serializedBinary();
+  /// \brief  access the serializedBinary attribute handle
+  /// \return the handle to the serializedBinary attribute
+
   /// \var    static MObject identifier();
   /// \brief  access the identifier attribute handle
   /// \return the handle to the identifier attribute
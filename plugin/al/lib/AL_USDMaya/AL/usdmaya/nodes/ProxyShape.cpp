@@ -267,8 +267,8 @@ void ProxyShape::translatePrimsIntoMaya(
 
   if(context()->isExcludedGeometryDirty())
   {
-    TF_DEBUG(ALUSDMAYA_EVALUATION).Msg("ProxyShape:translatePrimsIntoMaya excluded geometry has been modified, reconstructing imaging engine \n");
-    constructExcludedPrims(); //if excluded prims changed, this will call constructGLImagingEngine
+    TF_DEBUG(ALUSDMAYA_EVALUATION).Msg("ProxyShape:translatePrimsIntoMaya excluded geometry has been modified, updating imaging engine \n");
+    constructExcludedPrims(); //if excluded prims changed, this will update the imaging engine
   }
 }
 //----------------------------------------------------------------------------------------------------------------------
@@ -329,19 +329,10 @@ void ProxyShape::constructGLImagingEngine()
       // delete previous instance
       destroyGLImagingEngine();
 
-      const auto& translatedGeo = m_context->excludedGeometry();
-
-      // combine the excluded paths
-      SdfPathVector excludedGeometryPaths;
-      excludedGeometryPaths.reserve(m_excludedTaggedGeometry.size() + m_excludedGeometry.size() + translatedGeo.size());
-      excludedGeometryPaths.assign(m_excludedTaggedGeometry.begin(), m_excludedTaggedGeometry.end());
-      excludedGeometryPaths.insert(excludedGeometryPaths.end(), m_excludedGeometry.begin(), m_excludedGeometry.end());
-      for(auto& it : translatedGeo)
-      {
-        excludedGeometryPaths.push_back(it.second);
-      }
-
-      m_engine = new Engine(m_path, excludedGeometryPaths);
+      // Geometry tagged as excluded is never populated. The excluded and translated geometry can change
+      // at any time, e.g. on variant switches, so it is populated but invised: constructExcludedPrims()
+      // then updates the engine in place rather than constructing a new one.
+      m_engine = new Engine(m_path, m_excludedTaggedGeometry, invisedGeometryPaths());
       // set renderer plugin based on RendererManager setting
       RendererManager* manager = RendererManager::findManager();
       if(manager && m_engine)
@@ -354,6 +345,22 @@ void ProxyShape::constructGLImagingEngine()
   }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+SdfPathVector ProxyShape::invisedGeometryPaths() const
+{
+  const auto& translatedGeo = m_context->excludedGeometry();
+
+  // combine the excluded paths
+  SdfPathVector invisedPaths;
+  invisedPaths.reserve(m_excludedGeometry.size() + translatedGeo.size());
+  invisedPaths.assign(m_excludedGeometry.begin(), m_excludedGeometry.end());
+  for(auto& it : translatedGeo)
+  {
+    invisedPaths.push_back(it.second);
+  }
+  return invisedPaths;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 MStatus ProxyShape::setDependentsDirty(const MPlug& plugBeingDirtied, MPlugArray& plugs)
 {
@@ -693,13 +700,9 @@ void ProxyShape::onPrimResync(SdfPath primPath, SdfPathVector& previousPrims)
   TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("ProxyShape::onPrimResync begin:\n%s\n", context()->serialise().asChar());
 
   AL_BEGIN_PROFILE_SECTION(ObjectChanged);
-  MFnDagNode fn(thisMObject());
-  MDagPath proxyTransformPath;
-  fn.getPath(proxyTransformPath);
-  proxyTransformPath.pop();
 
   // find the new set of prims
-  UsdPrimVector newPrimSet = huntForNativeNodesUnderPrim(proxyTransformPath, primPath, translatorManufacture());
+  UsdPrimVector newPrimSet = huntForNativeNodesUnderPrim(primPath, translatorManufacture());
 
   // Remove prims that have disappeared and translate in new prims
   translatePrimsIntoMaya(newPrimSet, previousPrims);
@@ -838,6 +841,9 @@ void ProxyShape::serializeAll()
 //----------------------------------------------------------------------------------------------------------------------
 void ProxyShape::onObjectsChanged(UsdNotice::ObjectsChanged const& notice, UsdStageWeakPtr const& sender)
 {
+  // the index must know about every change, and before the hunts made below in response to it
+  m_schemaPrimIndex.processChangedObjects(notice, sender);
+
   if(MFileIO::isReadingFile() || AL::usdmaya::utils::BlockNotifications::isBlockingNotifications())
     return;
 
@@ -942,6 +948,9 @@ void ProxyShape::processChangedObjects(const SdfPathVector& resyncedPaths, const
     return;
   }
 
+  // the resync below translates prims in and out of maya one at a time, so defer the events raised meanwhile
+  AL::event::EventEditBlock editBlock(*scheduler());
+
   for(const SdfPath& path : resyncedPaths)
   {
     auto it = m_requiredPaths.find(path);
@@ -1027,14 +1036,12 @@ void ProxyShape::processChangedObjects(const SdfPathVector& resyncedPaths, const
 
 //----------------------------------------------------------------------------------------------------------------------
 std::vector<UsdPrim> ProxyShape::huntForNativeNodesUnderPrim(
-    const MDagPath& proxyTransformPath,
     SdfPath startPath,
     fileio::translators::TranslatorManufacture& manufacture,
     const bool importAll)
 {
   TF_DEBUG(ALUSDMAYA_EVALUATION).Msg("ProxyShape::huntForNativeNodesUnderPrim\n");
   std::vector<UsdPrim> prims;
-  fileio::SchemaPrimsUtils utils(manufacture);
 
   const UsdPrim prim = m_stage->GetPrimAtPath(startPath);
   if (!prim.IsValid())
@@ -1042,27 +1049,23 @@ std::vector<UsdPrim> ProxyShape::huntForNativeNodesUnderPrim(
     MString errorString;
     errorString.format(MString("'^1s' is not a valid prim path in proxy shape: '^2s'"),
                                startPath.GetString().c_str(),
-                               proxyTransformPath.fullPathName());
+                               name());
     MGlobal::displayError(errorString);
     return prims;
   }
 
-  fileio::TransformIterator it(prim, proxyTransformPath);
-  for(; !it.done(); it.next())
-  {
-    UsdPrim prim = it.prim();
-    if(!prim.IsValid())
-    {
-      continue;
-    }
+  // the index is a range query rather than a traversal of all the prims under the start path
+  return m_schemaPrimIndex.findSchemaPrims(prim, manufacture, importAll);
+}
 
-    fileio::translators::TranslatorRefPtr trans = utils.isSchemaPrim(prim);
-    if(trans && (trans->importableByDefault() || importAll))
-    {
-      prims.push_back(prim);
-    }
-  }
-  return prims;
+//----------------------------------------------------------------------------------------------------------------------
+std::vector<UsdPrim> ProxyShape::huntForNativeNodesUnderPrim(
+    const MDagPath&,
+    SdfPath startPath,
+    fileio::translators::TranslatorManufacture& manufacture,
+    const bool importAll)
+{
+  return huntForNativeNodesUnderPrim(startPath, manufacture, importAll);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1087,6 +1090,10 @@ void ProxyShape::variantSelectionListener(SdfNotice::LayersDidChange const& noti
 
   const SdfLayerHandleVector stack = m_stage->GetLayerStack();
 
+  // a single layer change can switch the variants of (or deactivate) many prims. The Pre/Post pairs are sent for
+  // each of them, but the events that can be deferred are only sent once, when the block ends.
+  AL::event::EventEditBlock editBlock(*scheduler());
+
 #if USD_VERSION_NUM > 1911
   TF_FOR_ALL(itr, notice.GetChangeListVec())
 #else
@@ -1106,7 +1113,7 @@ void ProxyShape::variantSelectionListener(SdfNotice::LayersDidChange const& noti
         if (it->first == SdfFieldKeys->VariantSelection ||
             it->first == SdfFieldKeys->Active)
         {
-          triggerEvent("PreVariantChangedCB");
+          triggerEvent("PreVariantChanged");
 
           TF_DEBUG(ALUSDMAYA_EVENTS).Msg("ProxyShape::variantSelectionListener oldPath=%s, oldIdentifier=%s, path=%s, layer=%s\n",
                                          entry.oldPath.GetText(),
@@ -1121,7 +1128,8 @@ void ProxyShape::variantSelectionListener(SdfNotice::LayersDidChange const& noti
           m_compositionHasChanged = true;
           onPrePrimChanged(path, m_variantSwitchedPrims);
 
-          triggerEvent("PostVariantChangedCB");
+          triggerEvent("PostVariantChanged");
+          triggerOrDeferEvent("VariantSwitchEnded");
         }
       }
     }
@@ -1893,6 +1901,7 @@ void ProxyShape::registerEvents()
   registerEvent("PostSelectionChanged", AL::event::kUSDMayaEventType);
   registerEvent("PreVariantChanged", AL::event::kUSDMayaEventType);
   registerEvent("PostVariantChanged", AL::event::kUSDMayaEventType);
+  registerEvent("VariantSwitchEnded", AL::event::kUSDMayaEventType);
   registerEvent("PreSerialiseContext", AL::event::kUSDMayaEventType, Global::postSave());
   registerEvent("PostSerialiseContext", AL::event::kUSDMayaEventType, Global::postSave());
   registerEvent("PreDeserialiseContext", AL::event::kUSDMayaEventType, Global::postRead());
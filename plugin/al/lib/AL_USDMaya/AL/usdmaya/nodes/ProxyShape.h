@@ -23,6 +23,7 @@
 #include "AL/usdmaya/Api.h"
 
 #include "AL/usdmaya/ForwardDeclares.h"
+#include "AL/usdmaya/fileio/SchemaPrims.h"
 #include "AL/usdmaya/fileio/translators/TranslatorBase.h"
 #include "AL/usdmaya/fileio/translators/TranslatorContext.h"
 #include "AL/usdmaya/nodes/proxy/LockManager.h"
@@ -431,11 +432,23 @@ public:
 
   /// \brief  traverses the UsdStage looking for the prims that are going to be handled by custom transformer
   ///         plug-ins.
-  /// \param  proxyTransformPath the DAG path of the proxy shape
   /// \param  startPath the path from which iteration needs to start in the UsdStage
   /// \param  manufacture the translator registry
   /// \return the array of prims found that will need to be imported
   AL_USDMAYA_PUBLIC
+  std::vector<UsdPrim> huntForNativeNodesUnderPrim(
+      SdfPath startPath,
+      fileio::translators::TranslatorManufacture& manufacture,
+      bool importAll = false);
+
+  /// \brief  traverses the UsdStage looking for the prims that are going to be handled by custom transformer
+  ///         plug-ins.
+  /// \param  proxyTransformPath unused, prims are found from the index of translatable prims of this proxy shape
+  /// \param  startPath the path from which iteration needs to start in the UsdStage
+  /// \param  manufacture the translator registry
+  /// \return the array of prims found that will need to be imported
+  /// \deprecated use the overload without proxyTransformPath
+  AL_USDMAYA_PUBLIC
   std::vector<UsdPrim> huntForNativeNodesUnderPrim(
       const MDagPath& proxyTransformPath,
       SdfPath startPath,
@@ -844,6 +857,9 @@ private:
 
   void constructExcludedPrims();
 
+  /// \brief  returns the excluded and translated geometry paths, which are hidden from the imaging engine
+  SdfPathVector invisedGeometryPaths() const;
+
   MObject makeUsdTransformChain_internal(
       const UsdPrim& usdPrim,
       MDagModifier& modifier,
@@ -1096,6 +1112,7 @@ private:
   SdfPath m_path;
   fileio::translators::TranslatorContextPtr m_context;
   fileio::translators::TranslatorManufacture m_translatorManufacture;
+  fileio::SchemaPrimIndex m_schemaPrimIndex;
   SdfPath m_changedPath;
   SdfPathVector m_variantSwitchedPrims;
   SdfLayerHandle m_prevEditTarget;
@@ -14,6 +14,7 @@
 // limitations under the License.
 //
 
+#include "AL/usdmaya/nodes/Engine.h"
 #include "AL/usdmaya/nodes/ProxyShape.h"
 #include "AL/usdmaya/nodes/Transform.h"
 #include "AL/usdmaya/Metadata.h"
@@ -242,7 +243,12 @@ void ProxyShape::constructExcludedPrims()
   if (m_excludedGeometry != excludedPaths)
   {
     std::swap(m_excludedGeometry, excludedPaths);
-    constructGLImagingEngine();
+
+    // only the subtrees whose exclusion changed are dirtied in an existing engine
+    if(!m_engine || !m_engine->SetInvisedPrimPaths(invisedGeometryPaths()))
+    {
+      constructGLImagingEngine();
+    }
   }
 }
 
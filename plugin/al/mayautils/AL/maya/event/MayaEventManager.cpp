@@ -13,6 +13,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //
+// Python.h has to be included ahead of the standard headers
+#include <Python.h>
+
 #include "AL/maya/event/MayaEventManager.h"
 
 #include <maya/MAnimMessage.h>
@@ -1186,6 +1189,61 @@ public:
     return MGlobal::executeCommand(code, false, true);
   }
 
+  std::shared_ptr<void> compilePython(const char* const code, const char* const tag) override
+  {
+    if(!Py_IsInitialized())
+    {
+      return std::shared_ptr<void>();
+    }
+
+    PyGILState_STATE state = PyGILState_Ensure();
+    PyObject* compiled = Py_CompileString(code, tag, Py_file_input);
+    if(!compiled)
+    {
+      // leave the error to be reported when the callback text is executed
+      PyErr_Clear();
+    }
+    PyGILState_Release(state);
+
+    if(!compiled)
+    {
+      return std::shared_ptr<void>();
+    }
+    return std::shared_ptr<void>(compiled, [](void* ptr)
+      {
+        if(Py_IsInitialized())
+        {
+          PyGILState_STATE state = PyGILState_Ensure();
+          Py_DECREF((PyObject*)ptr);
+          PyGILState_Release(state);
+        }
+      });
+  }
+
+  bool executeCompiledPython(const void* compiled) override
+  {
+    PyGILState_STATE state = PyGILState_Ensure();
+
+    // run in the same namespace as MGlobal::executePythonCommand would
+    PyObject* globals = PyModule_GetDict(PyImport_AddModule("__main__"));
+#if PY_MAJOR_VERSION >= 3
+    PyObject* result = PyEval_EvalCode((PyObject*)compiled, globals, globals);
+#else
+    PyObject* result = PyEval_EvalCode((PyCodeObject*)compiled, globals, globals);
+#endif
+    if(result)
+    {
+      Py_DECREF(result);
+    }
+    else
+    {
+      PyErr_Print();
+    }
+
+    PyGILState_Release(state);
+    return result != nullptr;
+  }
+
   void writeLog(EventSystemBinding::Type severity, const char* const text) override
   {
     switch(severity)
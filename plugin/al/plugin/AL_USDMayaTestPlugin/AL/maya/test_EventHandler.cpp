@@ -445,6 +445,78 @@ TEST(EventScheduler, registerCallbackAgainstEventThatDoesNotExist)
   EXPECT_TRUE(eventInfo == nullptr);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+static int g_deferredCount = 0;
+static void func_deferred(void* userData, NodeEvents* node)
+{
+  ++g_deferredCount;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+// void beginEditBlock();
+// void endEditBlock();
+// bool triggerOrDeferEvent(EventId eventId, FunctionBinder binder);
+// bool NodeEvents::triggerOrDeferEvent(const char* const eventName);
+//
+TEST(EventScheduler, editBlock)
+{
+  EventScheduler registrar(&g_eventSystem);
+  NodeEvents node(&registrar);
+  EXPECT_TRUE(node.registerEvent("EventType1", kUserSpecifiedEventType));
+  EXPECT_TRUE(node.registerEvent("EventType2", kUserSpecifiedEventType));
+  CallbackId id1 = registrar.registerCallback(node.getId("EventType1"), "tag", func_deferred, 1000);
+  CallbackId id2 = registrar.registerCallback(node.getId("EventType2"), "tag", func_deferred, 1000);
+
+  g_deferredCount = 0;
+  {
+    EventEditBlock block(registrar);
+    EXPECT_TRUE(registrar.isInEditBlock());
+    EXPECT_TRUE(node.triggerOrDeferEvent("EventType1"));
+    EXPECT_TRUE(node.triggerOrDeferEvent("EventType1"));
+    {
+      // nested blocks should not dispatch anything
+      EventEditBlock nested(registrar);
+      EXPECT_TRUE(node.triggerOrDeferEvent("EventType1"));
+      EXPECT_TRUE(node.triggerOrDeferEvent("EventType2"));
+    }
+    EXPECT_EQ(0, g_deferredCount);
+
+    // triggerEvent never defers, so that Pre/Post pairs stay around what they report
+    EXPECT_TRUE(node.triggerEvent("EventType2"));
+    EXPECT_EQ(1, g_deferredCount);
+    g_deferredCount = 0;
+    registrar.event(node.getId("EventType2"))->resetStatistics();
+  }
+  EXPECT_FALSE(registrar.isInEditBlock());
+
+  // each event should only have been dispatched once
+  EXPECT_EQ(2, g_deferredCount);
+  auto eventInfo = registrar.event(node.getId("EventType1"));
+  EXPECT_EQ(1u, eventInfo->triggerCount());
+  EXPECT_EQ(2u, eventInfo->coalescedCount());
+  eventInfo = registrar.event(node.getId("EventType2"));
+  EXPECT_EQ(1u, eventInfo->triggerCount());
+  EXPECT_EQ(0u, eventInfo->coalescedCount());
+
+  // outside of an edit block, events are dispatched immediately
+  EXPECT_TRUE(node.triggerOrDeferEvent("EventType2"));
+  EXPECT_EQ(3, g_deferredCount);
+  EXPECT_EQ(2u, eventInfo->triggerCount());
+  eventInfo->resetStatistics();
+  EXPECT_EQ(0u, eventInfo->triggerCount());
+
+  // events unregistered while queued should not be dispatched
+  registrar.beginEditBlock();
+  EXPECT_TRUE(node.triggerOrDeferEvent("EventType1"));
+  EXPECT_TRUE(registrar.unregisterCallback(id1));
+  EXPECT_TRUE(node.unregisterEvent("EventType1"));
+  registrar.endEditBlock();
+  EXPECT_EQ(3, g_deferredCount);
+
+  EXPECT_TRUE(registrar.unregisterCallback(id2));
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 static const char* const runBasicNodeEventTest =  R"(
 
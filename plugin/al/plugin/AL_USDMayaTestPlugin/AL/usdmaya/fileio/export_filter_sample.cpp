@@ -0,0 +1,214 @@
+//
+// Copyright 2020 Animal Logic
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "test_usdmaya.h"
+#include "AL/usdmaya/fileio/Export.h"
+
+#include <pxr/base/tf/errorMark.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/types.h>
+#include <pxr/usd/usd/references.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <chrono>
+#include <iostream>
+
+namespace {
+
+//----------------------------------------------------------------------------------------------------------------------
+/// the original filter, one ClearAtTime per sample, used as the reference output
+//----------------------------------------------------------------------------------------------------------------------
+void referenceFilterSamples(const UsdStageRefPtr& stage)
+{
+  std::vector<double> timeSamples;
+  std::vector<double> dupSamples;
+  for (auto prim : stage->Traverse())
+  {
+    std::vector<UsdAttribute> attributes = prim.GetAuthoredAttributes();
+    for (auto attr : attributes)
+    {
+      timeSamples.clear();
+      dupSamples.clear();
+      attr.GetTimeSamples(&timeSamples);
+      VtValue prevSampleBlob;
+      for (auto sample : timeSamples)
+      {
+        VtValue currSampleBlob;
+        attr.Get(&currSampleBlob, sample);
+        if (prevSampleBlob == currSampleBlob)
+        {
+          dupSamples.emplace_back(sample);
+        }
+        else
+        {
+          prevSampleBlob = currSampleBlob;
+          if (dupSamples.size() > 1)
+          {
+            dupSamples.pop_back();
+            for (auto dup : dupSamples)
+            {
+              attr.ClearAtTime(dup);
+            }
+          }
+          dupSamples.clear();
+        }
+      }
+      for (auto dup : dupSamples)
+      {
+        attr.ClearAtTime(dup);
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// A stage with a mix of constant runs at the start, middle and end of the samples, for the common types and a type
+/// that falls back on VtValue comparisons.
+//----------------------------------------------------------------------------------------------------------------------
+UsdStageRefPtr buildStage()
+{
+  UsdStageRefPtr stage = UsdStage::CreateInMemory();
+  UsdPrim prim = stage->DefinePrim(SdfPath("/root"));
+
+  // value per frame, runs of equal values are the redundant samples
+  const int pattern[] = { 0, 0, 0, 1, 2, 2, 3, 3, 3, 3, 4, 5, 5, 5 };
+
+  UsdAttribute floatAttr = prim.CreateAttribute(TfToken("floatAttr"), SdfValueTypeNames->Float);
+  UsdAttribute vecAttr = prim.CreateAttribute(TfToken("vecAttr"), SdfValueTypeNames->Point3f);
+  UsdAttribute arrayAttr = prim.CreateAttribute(TfToken("arrayAttr"), SdfValueTypeNames->FloatArray);
+  UsdAttribute stringAttr = prim.CreateAttribute(TfToken("stringAttr"), SdfValueTypeNames->String);
+  UsdAttribute constantAttr = prim.CreateAttribute(TfToken("constantAttr"), SdfValueTypeNames->Double);
+  UsdAttribute singleAttr = prim.CreateAttribute(TfToken("singleAttr"), SdfValueTypeNames->Int);
+  UsdAttribute uniformAttr = prim.CreateAttribute(TfToken("uniformAttr"), SdfValueTypeNames->Int);
+  uniformAttr.Set(1);
+  singleAttr.Set(1, UsdTimeCode(1.0));
+
+  double frame = 1.0;
+  for (int value : pattern)
+  {
+    floatAttr.Set(float(value), frame);
+    vecAttr.Set(GfVec3f(value, 0, 1), frame);
+    arrayAttr.Set(VtFloatArray(3, float(value)), frame);
+    stringAttr.Set(std::to_string(value), frame);
+    constantAttr.Set(1.0, frame);
+    frame += 1.0;
+  }
+  return stage;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+UsdStageRefPtr buildAnimatedStage(size_t numAttributes, size_t numFrames)
+{
+  UsdStageRefPtr stage = UsdStage::CreateInMemory();
+  for (size_t i = 0; i < numAttributes; ++i)
+  {
+    UsdPrim prim = stage->DefinePrim(SdfPath(std::string("/prim") + std::to_string(i / 10)));
+    UsdAttribute attr = prim.CreateAttribute(TfToken(std::string("attr") + std::to_string(i % 10)), SdfValueTypeNames->Double);
+    for (size_t frame = 0; frame < numFrames; ++frame)
+    {
+      // holds its value for a number of frames that depends on the attribute
+      attr.Set(double(frame / (1 + i % 7)), double(frame));
+    }
+  }
+  return stage;
+}
+
+std::string exportToString(const UsdStageRefPtr& stage)
+{
+  std::string text;
+  stage->GetRootLayer()->ExportToString(&text);
+  return text;
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(export_filter_sample, matchesReference)
+{
+  UsdStageRefPtr expected = buildStage();
+  referenceFilterSamples(expected);
+
+  UsdStageRefPtr filtered = buildStage();
+  AL::usdmaya::fileio::filterSamples(filtered);
+
+  EXPECT_EQ(exportToString(expected), exportToString(filtered));
+
+  UsdPrim prim = filtered->GetPrimAtPath(SdfPath("/root"));
+  std::vector<double> times;
+  prim.GetAttribute(TfToken("floatAttr")).GetTimeSamples(&times);
+  const std::vector<double> expectedTimes = { 1, 3, 4, 5, 6, 7, 10, 11, 12 };
+  EXPECT_EQ(expectedTimes, times);
+
+  prim.GetAttribute(TfToken("constantAttr")).GetTimeSamples(&times);
+  EXPECT_EQ(std::vector<double>{ 1 }, times);
+
+  prim.GetAttribute(TfToken("singleAttr")).GetTimeSamples(&times);
+  EXPECT_EQ(std::vector<double>{ 1 }, times);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(export_filter_sample, referencedLayer)
+{
+  // the samples of the referenced layer are not in the edit target and must be left alone
+  SdfLayerRefPtr referenced = SdfLayer::CreateAnonymous(".usda");
+  {
+    UsdStageRefPtr stage = UsdStage::Open(referenced);
+    UsdAttribute attr = stage->DefinePrim(SdfPath("/asset")).CreateAttribute(TfToken("referencedAttr"), SdfValueTypeNames->Float);
+    for (double frame = 1.0; frame <= 5.0; frame += 1.0)
+      attr.Set(1.0f, frame);
+  }
+
+  UsdStageRefPtr stage = UsdStage::CreateInMemory();
+  UsdPrim prim = stage->DefinePrim(SdfPath("/root"));
+  prim.GetReferences().AddReference(referenced->GetIdentifier(), SdfPath("/asset"));
+  UsdAttribute localAttr = prim.CreateAttribute(TfToken("localAttr"), SdfValueTypeNames->Float);
+  for (double frame = 1.0; frame <= 5.0; frame += 1.0)
+    localAttr.Set(1.0f, frame);
+
+  TfErrorMark errors;
+  AL::usdmaya::fileio::filterSamples(stage);
+  EXPECT_TRUE(errors.IsClean());
+
+  std::vector<double> times;
+  prim.GetAttribute(TfToken("referencedAttr")).GetTimeSamples(&times);
+  EXPECT_EQ(std::vector<double>({ 1, 2, 3, 4, 5 }), times);
+  EXPECT_EQ(5u, referenced->ListTimeSamplesForPath(SdfPath("/asset.referencedAttr")).size());
+
+  localAttr.GetTimeSamples(&times);
+  EXPECT_EQ(std::vector<double>{ 1 }, times);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(export_filter_sample, manyAnimatedAttributes)
+{
+  const size_t numAttributes = 4000;
+  const size_t numFrames = 100;
+
+  UsdStageRefPtr expected = buildAnimatedStage(numAttributes, numFrames);
+  auto start = std::chrono::steady_clock::now();
+  referenceFilterSamples(expected);
+  const std::chrono::duration<double> referenceTime = std::chrono::steady_clock::now() - start;
+
+  UsdStageRefPtr filtered = buildAnimatedStage(numAttributes, numFrames);
+  start = std::chrono::steady_clock::now();
+  AL::usdmaya::fileio::filterSamples(filtered);
+  const std::chrono::duration<double> filterTime = std::chrono::steady_clock::now() - start;
+
+  std::cout << "filterSamples on " << numAttributes << " attributes of " << numFrames << " samples: "
+            << filterTime.count() << "s, reference " << referenceTime.count() << "s" << std::endl;
+
+  EXPECT_EQ(exportToString(expected), exportToString(filtered));
+}
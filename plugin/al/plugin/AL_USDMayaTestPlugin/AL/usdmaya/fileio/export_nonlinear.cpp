@@ -1,5 +1,7 @@
 #include <maya/MGlobal.h>
 #include <maya/MFileIO.h>
+#include <maya/MAnimControl.h>
+#include <maya/MDGMessage.h>
 
 #include "test_usdmaya.h"
 
@@ -26,6 +28,16 @@ setKeyframe ($nl[0] + ".cur");
 }
 )";
 
+/// \brief  Counts the changes of the current time to any other time than the first frame of the export. The export
+///         itself goes to the first frame and back, which is not counted when the test starts on that frame.
+static void countTimeChanges(MTime& time, void* clientData)
+{
+  if(time.as(MTime::uiUnit()) != 1.0)
+  {
+    ++*static_cast<int*>(clientData);
+  }
+}
+
 TEST(export_nonlinear, nonanimated)
 {
   MFileIO::newFile(true);
@@ -87,7 +99,15 @@ TEST(export_nonlinear, animated)
   command += temp_path.c_str();
   command += "\";";
 
+  MAnimControl::setCurrentTime(MTime(1.0, MTime::uiUnit()));
+
+  int timeChanges = 0;
+  MCallbackId timeChangeCallback = MDGMessage::addTimeChangeCallback(countTimeChanges, &timeChanges);
   MGlobal::executeCommand(command);
+  MMessage::removeCallback(timeChangeCallback);
+
+  // without custom translators, the samples are evaluated without changing the current time
+  EXPECT_EQ(0, timeChanges);
 
   UsdStageRefPtr stage = UsdStage::Open(temp_path);
   EXPECT_TRUE(stage);
@@ -98,6 +118,11 @@ TEST(export_nonlinear, animated)
     UsdAttribute pointsAttr = mesh.GetPointsAttr();
     size_t size = pointsAttr.GetNumTimeSamples();
     EXPECT_EQ(50u, size);
+
+    VtArray<GfVec3f> firstPoints, lastPoints;
+    EXPECT_TRUE(pointsAttr.Get(&firstPoints, 1.0));
+    EXPECT_TRUE(pointsAttr.Get(&lastPoints, 50.0));
+    EXPECT_NE(firstPoints, lastPoints);
   }
 }
 
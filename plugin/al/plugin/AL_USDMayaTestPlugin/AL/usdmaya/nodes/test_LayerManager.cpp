@@ -14,6 +14,7 @@
 // limitations under the License.
 //
 #include "test_usdmaya.h"
+#include "AL/usdmaya/nodes/LayerBinaryData.h"
 #include "AL/usdmaya/nodes/LayerManager.h"
 #include "AL/usdmaya/StageCache.h"
 #include <maya/MDGModifier.h>
@@ -21,11 +22,13 @@
 #include <maya/MFnDagNode.h>
 #include <maya/MFnDependencyNode.h>
 #include <maya/MFnMessageAttribute.h>
+#include <maya/MFnPluginData.h>
 #include <maya/MGlobal.h>
 #include <maya/MItDependencyNodes.h>
 #include <maya/MSelectionList.h>
 #include <pxr/usd/sdf/attributeSpec.h>
 #include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/primSpec.h>
 #include <pxr/usd/usd/usdaFileFormat.h>
 #include <pxr/usd/usdGeom/xform.h>
 #include <pxr/usd/usdGeom/tokens.h>
@@ -67,6 +70,19 @@ void deleteLayerManager(MObject& mobj)
   EXPECT_EQ(dgMod.doIt(), MStatus::kSuccess);
 }
 
+AL::usdmaya::nodes::LayerBinaryData::Bytes getSerializedBytes(AL::usdmaya::nodes::LayerManager* manager, unsigned int index)
+{
+  MStatus status;
+  MPlug layersPlug = manager->layersPlug().elementByPhysicalIndex(index, &status);
+  EXPECT_TRUE(status);
+  MObject tempNonConst = manager->serializedBinary();
+  MPlug binaryPlug = layersPlug.child(tempNonConst, &status);
+  EXPECT_TRUE(status);
+  MFnPluginData fnData(binaryPlug.asMObject());
+  auto data = dynamic_cast<const AL::usdmaya::nodes::LayerBinaryData*>(fnData.constData());
+  return data ? data->bytes() : AL::usdmaya::nodes::LayerBinaryData::Bytes();
+}
+
 
 // Tests ---------------------------------------------------------------------------------------------------------------
 
@@ -363,8 +379,16 @@ def Scope "blabla"
 
     ASSERT_EQ(MString(realLayer->GetIdentifier().c_str()), idPlug.asString(MDGContext::fsNormal, &status));
     ASSERT_TRUE(status);
-    ASSERT_EQ(MString(LAYER_CONTENTS), serializedPlug.asString(MDGContext::fsNormal, &status));
+    // layers are stored as crate data, the text attribute is only read from older files
+    ASSERT_EQ(MString(), serializedPlug.asString(MDGContext::fsNormal, &status));
     ASSERT_TRUE(status);
+    auto bytes = getSerializedBytes(manager, 0);
+    ASSERT_TRUE(bytes);
+    auto restored = SdfLayer::CreateAnonymous("restored.usda");
+    ASSERT_TRUE(AL::usdmaya::nodes::LayerBinaryData::deserialise(*bytes, restored));
+    std::string restoredContents;
+    restored->ExportToString(&restoredContents);
+    ASSERT_EQ(std::string(LAYER_CONTENTS), restoredContents);
     ASSERT_FALSE(anonymousPlug.asBool(MDGContext::fsNormal, &status));
     ASSERT_TRUE(status);
   };
@@ -397,6 +421,43 @@ def Scope "blabla"
   { SCOPED_TRACE(""); assertLayersPopulated(); }
 }
 
+TEST(LayerManager, serializationSkipsUnchangedLayers)
+{
+  MFileIO::newFile(true);
+
+  auto *manager = AL::usdmaya::nodes::LayerManager::findOrCreateManager();
+  ASSERT_TRUE(manager);
+
+  auto layer = SdfLayer::CreateAnonymous("serializationSkipsUnchangedLayers.usda");
+  SdfPrimSpec::New(layer, "root", SdfSpecifierDef);
+  ASSERT_TRUE(manager->addLayer(layer));
+
+  // first save serializes the layer
+  ASSERT_TRUE(manager->populateSerialisationAttributes());
+  auto first = getSerializedBytes(manager, 0);
+  ASSERT_TRUE(first);
+  ASSERT_TRUE(manager->clearSerialisationAttributes());
+
+  // unchanged layer reuses the data from the previous save
+  ASSERT_TRUE(manager->populateSerialisationAttributes());
+  auto second = getSerializedBytes(manager, 0);
+  EXPECT_EQ(first.get(), second.get());
+  ASSERT_TRUE(manager->clearSerialisationAttributes());
+
+  // edited layer is serialized again
+  SdfPrimSpec::New(layer, "other", SdfSpecifierDef);
+  ASSERT_TRUE(manager->populateSerialisationAttributes());
+  auto third = getSerializedBytes(manager, 0);
+  ASSERT_TRUE(third);
+  EXPECT_NE(first.get(), third.get());
+  ASSERT_TRUE(manager->clearSerialisationAttributes());
+
+  auto restored = SdfLayer::CreateAnonymous("restored.usda");
+  ASSERT_TRUE(AL::usdmaya::nodes::LayerBinaryData::deserialise(*third, restored));
+  EXPECT_TRUE(restored->GetPrimAtPath(SdfPath("/root")));
+  EXPECT_TRUE(restored->GetPrimAtPath(SdfPath("/other")));
+}
+
 TEST(LayerManager, simpleSaveRestore)
 {
   MFileIO::newFile(true);
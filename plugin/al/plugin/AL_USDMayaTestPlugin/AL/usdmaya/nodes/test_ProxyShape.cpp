@@ -30,10 +30,13 @@
 #include <maya/MStringArray.h>
 #include <maya/MCommonSystemUtils.h>
 
+#include <pxr/usd/sdf/changeBlock.h>
 #include <pxr/usd/sdf/types.h>
 #include <pxr/usd/usd/attribute.h>
 #include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usd/usdaFileFormat.h>
+#include <pxr/usd/usd/variantSets.h>
+#include <pxr/usd/usdGeom/camera.h>
 #include <pxr/usd/usdGeom/xform.h>
 #include <pxr/usd/usdGeom/xformCommonAPI.h>
 
@@ -1144,10 +1147,175 @@ TEST(ProxyShape, boundingBox)
   AL_USDMAYA_UNTESTED;
 }
 
-// std::vector<UsdPrim> huntForNativeNodesUnderPrim(const MDagPath& proxyTransformPath, SdfPath startPath);
+// std::vector<UsdPrim> huntForNativeNodesUnderPrim(SdfPath startPath, TranslatorManufacture& manufacture, bool importAll);
 TEST(ProxyShape, huntForNativeNodesUnderPrim)
 {
-  AL_USDMAYA_UNTESTED;
+  MFileIO::newFile(true);
+
+  const std::string temp_path = buildTempPath("AL_USDMayaTests_huntForNativeNodesUnderPrim.usda");
+  {
+    auto stage = UsdStage::CreateInMemory();
+    stage->GetRootLayer()->ImportFromString(
+      "#usda 1.0\n"
+      "\n"
+      "def Xform \"root\" (\n"
+      "    variants = {\n"
+      "        string shot = \"a\"\n"
+      "    }\n"
+      "    add variantSets = \"shot\"\n"
+      ")\n"
+      "{\n"
+      "    def Xform \"group\"\n"
+      "    {\n"
+      "        def Camera \"cam\"\n"
+      "        {\n"
+      "        }\n"
+      "    }\n"
+      "    variantSet \"shot\" = {\n"
+      "        \"a\" {\n"
+      "            def Camera \"camA\"\n"
+      "            {\n"
+      "            }\n"
+      "        }\n"
+      "        \"b\" {\n"
+      "            def Camera \"camB\"\n"
+      "            {\n"
+      "            }\n"
+      "        }\n"
+      "    }\n"
+      "}\n");
+    stage->Export(temp_path, false);
+  }
+
+  MFnDagNode fn;
+  MObject xform = fn.create("transform");
+  MObject shape = fn.create("AL_usdmaya_ProxyShape", xform);
+  AL::usdmaya::nodes::ProxyShape* proxy = (AL::usdmaya::nodes::ProxyShape*)fn.userNode();
+  proxy->filePathPlug().setString(temp_path.c_str());
+
+  auto stage = proxy->getUsdStage();
+  ASSERT_TRUE(stage);
+  auto& manufacture = proxy->translatorManufacture();
+
+  auto hunt = [&](const char* startPath)
+  {
+    SdfPathVector paths;
+    for(const UsdPrim& prim : proxy->huntForNativeNodesUnderPrim(SdfPath(startPath), manufacture, true))
+      paths.push_back(prim.GetPath());
+    return paths;
+  };
+
+  EXPECT_EQ(SdfPathVector({ SdfPath("/root/camA"), SdfPath("/root/group/cam") }), hunt("/root"));
+  EXPECT_EQ(SdfPathVector({ SdfPath("/root/group/cam") }), hunt("/root/group"));
+
+  // the deprecated overload ignores the proxy transform path
+  MDagPath proxyTransformPath;
+  MDagPath::getAPathTo(xform, proxyTransformPath);
+  EXPECT_EQ(size_t(2),
+            proxy->huntForNativeNodesUnderPrim(proxyTransformPath, SdfPath("/root"), manufacture, true).size());
+
+  // resync a subtree: the prims added and removed must be found by the next hunt
+  UsdGeomCamera::Define(stage, SdfPath("/root/group/cam2"));
+  stage->RemovePrim(SdfPath("/root/group/cam"));
+  EXPECT_EQ(SdfPathVector({ SdfPath("/root/group/cam2") }), hunt("/root/group"));
+
+  // prims which are not traversed, e.g. under an inactive prim, are not found
+  stage->GetPrimAtPath(SdfPath("/root/group")).SetActive(false);
+  EXPECT_EQ(SdfPathVector({ SdfPath("/root/camA") }), hunt("/root"));
+
+  // a variant switch is resynced and hunted by the proxy shape while it handles the change, which must see the new
+  // variant and import its camera
+  stage->GetPrimAtPath(SdfPath("/root")).GetVariantSet("shot").SetVariantSelection("b");
+  EXPECT_EQ(SdfPathVector({ SdfPath("/root/camB") }), hunt("/root"));
+
+  AL::usdmaya::fileio::translators::MObjectHandleArray handles;
+  EXPECT_TRUE(proxy->context()->getMObjects(SdfPath("/root/camB"), handles));
+  EXPECT_FALSE(proxy->context()->getMObjects(SdfPath("/root/camA"), handles));
+}
+
+static void countProxyShapeEvent(void* userData, AL::event::NodeEvents*)
+{
+  ++*static_cast<int*>(userData);
+}
+
+// void variantSelectionListener(SdfNotice::LayersDidChange const& notice);
+TEST(ProxyShape, variantSwitchEvents)
+{
+  MFileIO::newFile(true);
+
+  const std::string temp_path = buildTempPath("AL_USDMayaTests_variantSwitchEvents.usda");
+  {
+    std::string layer = "#usda 1.0\n";
+    for(const char* name : { "A", "B", "C" })
+    {
+      layer += std::string(
+        "def Xform \"") + name + "\" (\n"
+        "    variants = {\n"
+        "        string shot = \"a\"\n"
+        "    }\n"
+        "    add variantSets = \"shot\"\n"
+        ")\n"
+        "{\n"
+        "    variantSet \"shot\" = {\n"
+        "        \"a\" {\n"
+        "            def Camera \"camA\"\n"
+        "            {\n"
+        "            }\n"
+        "        }\n"
+        "        \"b\" {\n"
+        "            def Camera \"camB\"\n"
+        "            {\n"
+        "            }\n"
+        "        }\n"
+        "    }\n"
+        "}\n";
+    }
+    auto stage = UsdStage::CreateInMemory();
+    stage->GetRootLayer()->ImportFromString(layer);
+    stage->Export(temp_path, false);
+  }
+
+  MFnDagNode fn;
+  MObject xform = fn.create("transform");
+  MObject shape = fn.create("AL_usdmaya_ProxyShape", xform);
+  AL::usdmaya::nodes::ProxyShape* proxy = (AL::usdmaya::nodes::ProxyShape*)fn.userNode();
+  proxy->filePathPlug().setString(temp_path.c_str());
+
+  auto stage = proxy->getUsdStage();
+  ASSERT_TRUE(stage);
+
+  int preCount = 0, postCount = 0, endedCount = 0;
+  AL::event::EventScheduler* scheduler = proxy->scheduler();
+  AL::event::CallbackId callbacks[] = {
+    scheduler->registerCallback(proxy->getId("PreVariantChanged"), "test", countProxyShapeEvent, 1000, &preCount),
+    scheduler->registerCallback(proxy->getId("PostVariantChanged"), "test", countProxyShapeEvent, 1000, &postCount),
+    scheduler->registerCallback(proxy->getId("VariantSwitchEnded"), "test", countProxyShapeEvent, 1000, &endedCount)
+  };
+
+  // switch all the variants in a single layer change
+  {
+    SdfChangeBlock changeBlock;
+    for(const char* path : { "/A", "/B", "/C" })
+    {
+      stage->GetPrimAtPath(SdfPath(path)).GetVariantSet("shot").SetVariantSelection("b");
+    }
+  }
+
+  // a Pre/Post pair for every prim, but the deferred event only once
+  EXPECT_EQ(3, preCount);
+  EXPECT_EQ(3, postCount);
+  EXPECT_EQ(1, endedCount);
+  EXPECT_EQ(2u, scheduler->event(proxy->getId("VariantSwitchEnded"))->coalescedCount());
+
+  // the resync still happened
+  AL::usdmaya::fileio::translators::MObjectHandleArray handles;
+  EXPECT_TRUE(proxy->context()->getMObjects(SdfPath("/B/camB"), handles));
+  EXPECT_FALSE(proxy->context()->getMObjects(SdfPath("/B/camA"), handles));
+
+  for(AL::event::CallbackId callback : callbacks)
+  {
+    EXPECT_TRUE(scheduler->unregisterCallback(callback));
+  }
 }
 
 // void createSelectionChangedCallback();
@@ -0,0 +1,253 @@
+//
+// Copyright 2017 Animal Logic
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "AL/usd/transaction/ChangeJournal.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace AL {
+namespace usd {
+namespace transaction {
+
+namespace
+{
+typedef std::unordered_set<SdfPath, SdfPath::Hash> PathSet;
+
+/// returns true when any ancestor prim of given path (excluding pseudo root) is in provided set
+bool hasAncestorIn(const SdfPath& path, const PathSet& paths)
+{
+  const SdfPath& root = SdfPath::AbsoluteRootPath();
+  for (SdfPath parent = path.GetParentPath(); !parent.IsEmpty() && parent != root; parent = parent.GetParentPath())
+  {
+    if (paths.count(parent))
+      return true;
+  }
+  return false;
+}
+
+/// returns owning property path for target, connection, mapper and relational attribute paths
+SdfPath owningProperty(SdfPath path)
+{
+  while (!path.IsEmpty() && !path.IsPrimPropertyPath())
+  {
+    if (path.IsPrimPath() || path.IsAbsoluteRootPath())
+      return SdfPath();
+    path = path.GetParentPath();
+  }
+  return path;
+}
+} // anonymous namespace
+
+//----------------------------------------------------------------------------------------------------------------------
+ChangeJournal::ChangeJournal(const SdfLayerHandle& layer)
+  : m_layer(layer)
+{
+  TfWeakPtr<ChangeJournal> self(this);
+  m_noticeKey = TfNotice::Register(self, &ChangeJournal::onLayersDidChange);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+ChangeJournal::~ChangeJournal()
+{
+  TfNotice::Revoke(m_noticeKey);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void ChangeJournal::onLayersDidChange(const SdfNotice::LayersDidChange& notice)
+{
+  if (!m_layer)
+    return;
+
+#if PXR_VERSION > 1911
+  for (const auto& layerChanges : notice.GetChangeListVec())
+#else
+  for (const auto& layerChanges : notice.GetChangeListMap())
+#endif
+  {
+    if (layerChanges.first == m_layer)
+    {
+      record(layerChanges.second);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void ChangeJournal::record(const SdfChangeList& changeList)
+{
+  bool replacedContent = false;
+  bool fineGrained = false;
+  for (const auto& pathEntry : changeList.GetEntryList())
+  {
+    const SdfPath& path = pathEntry.first;
+    const SdfChangeList::Entry& entry = pathEntry.second;
+    const auto& flags = entry.flags;
+
+    if (path.IsAbsoluteRootPath())
+    {
+      /// Prim fields are not part of the comparison, only content replacement matters on the pseudo root
+      replacedContent |= flags.didReplaceContent;
+      continue;
+    }
+    /// Variant contents are not tracked by transactions
+    if (path.ContainsPrimVariantSelection())
+      continue;
+
+    fineGrained = true;
+    if (path.IsPrimPath())
+    {
+      if (flags.didRename && !entry.oldPath.IsEmpty())
+      {
+        recordPrim(entry.oldPath, false, true);
+        recordPrim(path, true, false);
+        continue;
+      }
+      const bool added = flags.didAddInertPrim || flags.didAddNonInertPrim;
+      const bool removed = flags.didRemoveInertPrim || flags.didRemoveNonInertPrim;
+      if (added || removed)
+      {
+        recordPrim(path, added, removed);
+      }
+    }
+    else if (path.IsPrimPropertyPath())
+    {
+      if (flags.didRename && !entry.oldPath.IsEmpty())
+      {
+        recordProperty(entry.oldPath, SdfChangeList::Entry(), false, true);
+        recordProperty(path, entry, true, false);
+        continue;
+      }
+      const bool added = flags.didAddProperty || flags.didAddPropertyWithOnlyRequiredFields;
+      const bool removed = flags.didRemoveProperty || flags.didRemovePropertyWithOnlyRequiredFields;
+      recordProperty(path, entry, added, removed);
+    }
+    else
+    {
+      /// Targets, connections and relational attributes are reported as a change of owning property
+      const SdfPath property = owningProperty(path);
+      if (!property.IsEmpty())
+      {
+        recordProperty(property, SdfChangeList::Entry(), false, false);
+        m_properties[property].dirty = true;
+      }
+    }
+  }
+
+  /// Streaming layers replace their content with a single notification and no per spec information,
+  /// in which case we can't tell which hierarchy was affected.
+  if (replacedContent && !fineGrained)
+  {
+    m_contentReplaced = true;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void ChangeJournal::recordPrim(const SdfPath& path, bool added, bool removed)
+{
+  /// When spec was both removed and added within one change list, removal came first
+  auto pair = m_prims.emplace(path, PrimRecord{!added || removed, false});
+  pair.first->second.replaced |= removed;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void ChangeJournal::recordProperty(const SdfPath& path, const SdfChangeList::Entry& entry, bool added, bool removed)
+{
+  auto pair = m_properties.emplace(path, PropertyRecord{!added || removed, false, false, {}});
+  PropertyRecord& record = pair.first->second;
+  record.replaced |= removed;
+  /// Target and connection list edits are not reported as info changes, only with their own flags
+  record.dirty |= entry.flags.didChangeAttributeTimeSamples || entry.flags.didChangeRelationshipTargets ||
+                  entry.flags.didChangeAttributeConnection;
+
+  /// Previous field values are only meaningful while spec content is still the original one
+  if (record.replaced || !record.existed)
+    return;
+
+  for (const auto& info : entry.infoChanged)
+  {
+    auto it = std::find_if(record.fields.begin(), record.fields.end(),
+                           [&info](const std::pair<TfToken, VtValue>& field) { return field.first == info.first; });
+    if (it == record.fields.end())
+    {
+      record.fields.emplace_back(info.first, info.second.first);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void ChangeJournal::Collect(SdfPathVector& changed, SdfPathVector& resynced) const
+{
+  if (!m_layer)
+    return;
+
+  if (m_contentReplaced)
+  {
+    resynced.push_back(SdfPath::AbsoluteRootPath());
+    return;
+  }
+
+  PathSet candidates;
+  for (const auto& prim : m_prims)
+  {
+    const bool exists = m_layer->HasSpec(prim.first);
+    if (prim.second.existed != exists || (exists && prim.second.replaced))
+    {
+      candidates.insert(prim.first);
+    }
+  }
+
+  /// Report topmost prims only, same as hierarchy comparison would
+  PathSet topmost;
+  for (const auto& path : candidates)
+  {
+    if (!hasAncestorIn(path, candidates))
+    {
+      topmost.insert(path);
+      resynced.push_back(path);
+    }
+  }
+
+  for (const auto& property : m_properties)
+  {
+    const SdfPath& path = property.first;
+    const PropertyRecord& record = property.second;
+    const SdfPath primPath = path.GetPrimPath();
+    if (topmost.count(primPath) || hasAncestorIn(primPath, topmost))
+      continue;
+
+    const bool exists = m_layer->HasSpec(path);
+    bool didChange = record.existed != exists;
+    if (!didChange && exists)
+    {
+      didChange = record.replaced || record.dirty ||
+        std::any_of(record.fields.begin(), record.fields.end(),
+                    [this, &path](const std::pair<TfToken, VtValue>& field) {
+                      return m_layer->GetField(path, field.first) != field.second;
+                    });
+    }
+    if (didChange)
+    {
+      changed.push_back(path);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+} // transaction
+} // usd
+} // AL
+//----------------------------------------------------------------------------------------------------------------------
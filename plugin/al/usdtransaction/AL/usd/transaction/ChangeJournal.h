@@ -0,0 +1,104 @@
+//
+// Copyright 2017 Animal Logic
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#pragma once
+#include "AL/usd/transaction/Api.h"
+
+#include <pxr/pxr.h>
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/usd/sdf/changeList.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/notice.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace AL {
+namespace usd {
+namespace transaction {
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  Records edits made to a single layer by listening to SdfNotice::LayersDidChange, so that the net change
+///         of a transaction can be computed without snapshotting the layer.
+///
+///         For every touched prim and property the journal remembers whether the spec existed when it was first
+///         touched, and for every property field the value it had before the first edit. On Collect those records
+///         are compared against the current layer state, which costs O(edited specs) rather than O(layer size).
+///
+/// \note   The journal is exact for field edits and for specs that are added or removed. When a spec that existed
+///         before the transaction is removed and later re-created, its previous contents are unknown and it is
+///         reported as changed (properties) or resynced (prims). When the layer content is replaced without
+///         fine-grained notification (e.g. reloading a streaming crate layer) the pseudo root is reported as resynced.
+//----------------------------------------------------------------------------------------------------------------------
+class ChangeJournal : public PXR_NS::TfWeakBase
+{
+public:
+  /// \brief  the ctor starts recording changes made to given layer
+  /// \param  layer that will be tracked for changes
+  AL_USD_TRANSACTION_PUBLIC
+  explicit ChangeJournal(const PXR_NS::SdfLayerHandle& layer);
+
+  /// \brief  the dtor stops recording changes
+  AL_USD_TRANSACTION_PUBLIC
+  ~ChangeJournal();
+
+  /// \brief  computes the net changes recorded since the journal was created, in the same form as a full
+  ///         comparison of the layer against a snapshot would report them.
+  /// \param  changed vector that will receive paths of changed properties
+  /// \param  resynced vector that will receive topmost paths for which hierarchy has changed
+  AL_USD_TRANSACTION_PUBLIC
+  void Collect(PXR_NS::SdfPathVector& changed, PXR_NS::SdfPathVector& resynced) const;
+
+  /// \brief  provides number of specs recorded by the journal
+  /// \return number of touched prim and property specs
+  inline size_t GetNumEntries() const { return m_prims.size() + m_properties.size(); }
+
+private:
+  ChangeJournal(const ChangeJournal&) = delete;
+  ChangeJournal& operator=(const ChangeJournal&) = delete;
+
+  void onLayersDidChange(const PXR_NS::SdfNotice::LayersDidChange& notice);
+  void record(const PXR_NS::SdfChangeList& changeList);
+  void recordPrim(const PXR_NS::SdfPath& path, bool added, bool removed);
+  void recordProperty(const PXR_NS::SdfPath& path, const PXR_NS::SdfChangeList::Entry& entry, bool added, bool removed);
+
+  struct PrimRecord
+  {
+    bool existed;   ///< spec existed before it was touched for the first time
+    bool replaced;  ///< spec was removed at some point, its previous content is unknown
+  };
+  struct PropertyRecord
+  {
+    bool existed;   ///< spec existed before it was touched for the first time
+    bool replaced;  ///< spec was removed at some point, its previous content is unknown
+    bool dirty;     ///< spec was edited in a way that does not report previous values (e.g. time samples)
+    std::vector<std::pair<PXR_NS::TfToken, PXR_NS::VtValue>> fields; ///< field values before the first edit
+  };
+
+  PXR_NS::SdfLayerHandle m_layer;
+  PXR_NS::TfNotice::Key m_noticeKey;
+  std::unordered_map<PXR_NS::SdfPath, PrimRecord, PXR_NS::SdfPath::Hash> m_prims;
+  std::unordered_map<PXR_NS::SdfPath, PropertyRecord, PXR_NS::SdfPath::Hash> m_properties;
+  bool m_contentReplaced = false;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+} // transaction
+} // usd
+} // AL
+//----------------------------------------------------------------------------------------------------------------------
@@ -15,6 +15,8 @@
 //
 #include "AL/usd/transaction/TransactionManager.h"
 
+#include <unordered_set>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace AL {
@@ -92,6 +94,34 @@ void comparePrims(const SdfPrimSpecHandle& a, const SdfPrimSpecHandle& b, SdfPat
   };
   compareSpecViews(a->GetProperties(), b->GetProperties(), changed, resynced, compareProps);
 }
+
+/// Warns about paths reported by full comparison that are neither reported nor covered by journal
+void validateJournal(const SdfLayerHandle& layer, const SdfPathVector& journalChanged, const SdfPathVector& journalResynced,
+                     const SdfPathVector& changed, const SdfPathVector& resynced)
+{
+  std::unordered_set<SdfPath, SdfPath::Hash> reported(journalChanged.begin(), journalChanged.end());
+  reported.insert(journalResynced.begin(), journalResynced.end());
+  auto isReported = [&reported](const SdfPath& path)
+  {
+    for (SdfPath p = path; !p.IsEmpty(); p = p.GetParentPath())
+    {
+      if (reported.count(p))
+        return true;
+    }
+    return false;
+  };
+  for (const auto& paths : {&changed, &resynced})
+  {
+    for (const auto& path : *paths)
+    {
+      if (!isReported(path))
+      {
+        TF_WARN("Transaction journal for layer '%s' did not record change of '%s'",
+                layer->GetIdentifier().c_str(), path.GetText());
+      }
+    }
+  }
+}
 } // anonymous namespace
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -101,6 +131,13 @@ TransactionManager::StageManagerMap& TransactionManager::GetManagers()
   return managers;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+TransactionManager::TrackingMode& TransactionManager::GetMode()
+{
+  static TrackingMode mode = TrackingMode::kJournal;
+  return mode;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 bool TransactionManager::InProgress(const SdfLayerHandle& layer) const
 {
@@ -118,12 +155,20 @@ bool TransactionManager::Open(const SdfLayerHandle& layer)
 {
   if (m_stage && layer)
   {
-    auto pair = m_transactions.emplace(get_pointer(layer), TransactionData{nullptr, 1});
+    auto pair = m_transactions.emplace(get_pointer(layer), TransactionData());
     if (pair.second)
     {
-      auto& base = pair.first->second.base;
-      base = SdfLayer::CreateAnonymous("transaction_base");
-      base->TransferContent(layer);
+      auto& data = pair.first->second;
+      data.mode = GetMode();
+      if (data.mode != TrackingMode::kDiff)
+      {
+        data.journal.reset(new ChangeJournal(layer));
+      }
+      if (data.mode != TrackingMode::kJournal)
+      {
+        data.base = SdfLayer::CreateAnonymous("transaction_base");
+        data.base->TransferContent(layer);
+      }
       OpenNotice(layer).Send(m_stage);
     }
     else
@@ -144,10 +189,25 @@ bool TransactionManager::Close(const SdfLayerHandle& layer)
     auto it = m_transactions.find(get_pointer(layer));
     if (it != m_transactions.end())
     {
-      if (--it->second.count == 0)
+      auto& data = it->second;
+      if (--data.count == 0)
       {
         SdfPathVector changedInfo, resynched;
-        comparePrims(it->second.base->GetPseudoRoot(), layer->GetPseudoRoot(), resynched, changedInfo);
+        if (data.base)
+        {
+          comparePrims(data.base->GetPseudoRoot(), layer->GetPseudoRoot(), resynched, changedInfo);
+          if (data.journal)
+          {
+            SdfPathVector journalChanged, journalResynced;
+            data.journal->Collect(journalChanged, journalResynced);
+            validateJournal(layer, journalChanged, journalResynced, changedInfo, resynched);
+          }
+        }
+        else
+        {
+          data.journal->Collect(changedInfo, resynched);
+        }
+        data.journal.reset();
         CloseNotice(layer, std::move(changedInfo), std::move(resynched)).Send(m_stage);
         m_transactions.erase(it);
       }
@@ -162,6 +222,18 @@ bool TransactionManager::Close(const SdfLayerHandle& layer)
 
 // static inteface //
 
+//----------------------------------------------------------------------------------------------------------------------
+void TransactionManager::SetTrackingMode(TrackingMode mode)
+{
+  GetMode() = mode;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TransactionManager::TrackingMode TransactionManager::GetTrackingMode()
+{
+  return GetMode();
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 TransactionManager& TransactionManager::Get(const UsdStageWeakPtr& stage)
 {
@@ -15,11 +15,14 @@
 //
 #pragma once
 #include "AL/usd/transaction/Api.h"
+#include "AL/usd/transaction/ChangeJournal.h"
 #include "AL/usd/transaction/Notice.h"
 
 #include <pxr/pxr.h>
 #include <pxr/base/tf/weakPtr.h>
 
+#include <memory>
+
 namespace AL {
 namespace usd {
 namespace transaction {
@@ -31,9 +34,10 @@ namespace transaction {
 ///         as static interface where stage needs to be provided.
 ///
 ///         Whenever a new transaction (first one targeting given layer) is opened an OpenNotice is being
-///         emitted and snapshot of given layer is taken.
-///         Whenever last transaction targeting given layer for given stage is closed, targetted layer content
-///         is being compared against previously taken snapshot and CloseNotice is emitted with delta information.
+///         emitted and changes to given layer start being recorded.
+///         Whenever last transaction targeting given layer for given stage is closed, recorded changes are
+///         resolved against current layer content and CloseNotice is emitted with delta information.
+///         See TrackingMode for the available strategies of recording changes.
 ///
 /// \note   It's user responsibilty to pair Open with Close calls, otherwise clients might not respond to any 
 ///         further changes. As such it's advisable to prefer ScopedTransaction whenever possible.
@@ -41,6 +45,14 @@ namespace transaction {
 class TransactionManager
 {
 public:
+  /// \brief  strategy used to compute delta information reported by CloseNotice
+  enum class TrackingMode
+  {
+    kJournal,   ///< edits are recorded from layer change notices while open, close costs O(edited specs)
+    kDiff,      ///< layer is copied on open and compared in full on close, close costs O(layer size)
+    kValidate   ///< both of the above, journal discrepancies are reported as warnings and diff result is used
+  };
+
   /// \brief  provides information whether transaction was opened and wasn't closed yet.
   /// \param  layer targetted by transaction
   /// \return true when transaction is in progress, otherwise false
@@ -106,6 +118,16 @@ public:
   /// \return true on success, false when layer or stage became invalid or transaction wasn't opened
   AL_USD_TRANSACTION_PUBLIC
   static bool Close(const PXR_NS::UsdStageWeakPtr& stage, const PXR_NS::SdfLayerHandle& layer);
+
+  /// \brief  sets strategy used by transactions opened from now on, transactions in progress are not affected.
+  /// \param  mode tracking mode, kJournal by default
+  AL_USD_TRANSACTION_PUBLIC
+  static void SetTrackingMode(TrackingMode mode);
+
+  /// \brief  provides strategy used by newly opened transactions
+  /// \return current tracking mode
+  AL_USD_TRANSACTION_PUBLIC
+  static TrackingMode GetTrackingMode();
 private:
   typedef std::map<PXR_NS::UsdStageWeakPtr, TransactionManager> StageManagerMap;
   static StageManagerMap& GetManagers();
@@ -114,8 +136,11 @@ private:
   struct TransactionData
   {
     PXR_NS::SdfLayerRefPtr base;
-    int count;
+    std::unique_ptr<ChangeJournal> journal;
+    TrackingMode mode = TrackingMode::kJournal;
+    int count = 1;
   };
+  static TrackingMode& GetMode();
   const PXR_NS::UsdStageWeakPtr m_stage;
   std::unordered_map<PXR_NS::SdfLayer*, TransactionData> m_transactions;
 };
@@ -1,9 +1,11 @@
 #include "AL/usd/transaction/Notice.h"
 #include "AL/usd/transaction/Transaction.h"
+#include "AL/usd/transaction/TransactionManager.h"
 
 #include <pxr/pxr.h>
 #include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/relationship.h>
 
 #include <gtest/gtest.h>
 
@@ -87,6 +89,7 @@ class TransactionTest : public TfWeakBase, public ::testing::Test {
 
     void SetUp() override
     {
+      m_mode = TransactionManager::GetTrackingMode();
       m_stage = UsdStage::CreateInMemory();
       m_stage->SetEditTarget(m_stage->GetSessionLayer());
       TfWeakPtr<TransactionTest> self(this);
@@ -99,6 +102,7 @@ class TransactionTest : public TfWeakBase, public ::testing::Test {
     void TearDown() override {
       TfNotice::Revoke(m_openNoticeKey);
       TfNotice::Revoke(m_closeNoticeKey);
+      TransactionManager::SetTrackingMode(m_mode);
     }
     
     UsdStageRefPtr m_stage;
@@ -106,6 +110,7 @@ class TransactionTest : public TfWeakBase, public ::testing::Test {
   private:
     TfNotice::Key m_openNoticeKey;
     TfNotice::Key m_closeNoticeKey;
+    TransactionManager::TrackingMode m_mode;
     size_t m_opened = 0;
     size_t m_closed = 0;
     SdfPathVector m_changed;
@@ -266,6 +271,8 @@ TEST_F(TransactionTest, Properties)
 /// Test that CloseNotice reports clearing layers as expected
 TEST_F(TransactionTest, Clear)
 {
+  /// Only full comparison is able to tell that re-created content matches the original one
+  TransactionManager::SetTrackingMode(TransactionManager::TrackingMode::kDiff);
   EXPECT_EQ(sorted(getChanged()), empty());
   EXPECT_EQ(sorted(getResynced()), empty());
   {
@@ -301,3 +308,111 @@ TEST_F(TransactionTest, Clear)
   EXPECT_EQ(sorted(getChanged()), empty());
   EXPECT_EQ(sorted(getResynced()), empty());
 }
+
+/// Test that journal reports re-created content conservatively
+TEST_F(TransactionTest, ClearJournal)
+{
+  TransactionManager::SetTrackingMode(TransactionManager::TrackingMode::kJournal);
+  {
+    ScopedTransaction transaction(m_stage, m_stage->GetSessionLayer());
+    createPrimWithAttribute("/root");
+    createPrimWithAttribute("/root/A");
+  }
+  EXPECT_EQ(sorted(getChanged()), empty());
+  EXPECT_EQ(sorted(getResynced()), sorted({"/root"}));
+  {
+    ScopedTransaction transaction(m_stage, m_stage->GetSessionLayer());
+    m_stage->GetSessionLayer()->Clear();
+  }
+  EXPECT_EQ(sorted(getChanged()), empty());
+  EXPECT_EQ(sorted(getResynced()), sorted({"/root"}));
+  {
+    ScopedTransaction transaction(m_stage, m_stage->GetSessionLayer());
+    createPrimWithAttribute("/root");
+    createPrimWithAttribute("/root/A");
+    m_stage->GetSessionLayer()->Clear();
+    /// effectively no change
+  }
+  EXPECT_EQ(sorted(getChanged()), empty());
+  EXPECT_EQ(sorted(getResynced()), empty());
+  {
+    ScopedTransaction transaction(m_stage, m_stage->GetSessionLayer());
+    createPrimWithAttribute("/root");
+  }
+  {
+    ScopedTransaction transaction(m_stage, m_stage->GetSessionLayer());
+    m_stage->GetSessionLayer()->Clear();
+    createPrimWithAttribute("/root");
+    /// previous content of /root is unknown to the journal
+  }
+  EXPECT_EQ(sorted(getChanged()), empty());
+  EXPECT_EQ(sorted(getResynced()), sorted({"/root"}));
+}
+
+/// Test that journal and full comparison report same changes for removals and time samples
+TEST_F(TransactionTest, Validate)
+{
+  {
+    ScopedTransaction transaction(m_stage, m_stage->GetSessionLayer());
+    createPrimWithAttribute("/root");
+    createPrimWithAttribute("/root/A");
+    createPrimWithAttribute("/root/B");
+  }
+  for (auto mode : {TransactionManager::TrackingMode::kJournal, TransactionManager::TrackingMode::kDiff,
+                    TransactionManager::TrackingMode::kValidate})
+  {
+    TransactionManager::SetTrackingMode(mode);
+    {
+      ScopedTransaction transaction(m_stage, m_stage->GetSessionLayer());
+      auto attr = m_stage->GetPrimAtPath(SdfPath("/root/A")).GetAttribute(TfToken("prop"));
+      EXPECT_TRUE(attr.Set(3, UsdTimeCode(1.0)));
+      createPrimWithAttribute("/root/C");
+    }
+    EXPECT_EQ(sorted(getChanged()), sorted({"/root/A.prop"}));
+    EXPECT_EQ(sorted(getResynced()), sorted({"/root/C"}));
+    {
+      ScopedTransaction transaction(m_stage, m_stage->GetSessionLayer());
+      m_stage->RemovePrim(SdfPath("/root/C"));
+      m_stage->GetPrimAtPath(SdfPath("/root/A")).GetAttribute(TfToken("prop")).Clear();
+    }
+    EXPECT_EQ(sorted(getChanged()), sorted({"/root/A.prop"}));
+    EXPECT_EQ(sorted(getResynced()), sorted({"/root/C"}));
+    createPrimWithAttribute("/root/A");
+  }
+}
+
+/// Test that journal and full comparison report edits of relationship targets and attribute connections
+TEST_F(TransactionTest, TargetsAndConnections)
+{
+  {
+    ScopedTransaction transaction(m_stage, m_stage->GetSessionLayer());
+    createPrimWithAttribute("/root");
+    createPrimWithAttribute("/root/A");
+    EXPECT_TRUE(m_stage->GetPrimAtPath(SdfPath("/root")).CreateRelationship(TfToken("rel")));
+  }
+  for (auto mode : {TransactionManager::TrackingMode::kJournal, TransactionManager::TrackingMode::kDiff,
+                    TransactionManager::TrackingMode::kValidate})
+  {
+    TransactionManager::SetTrackingMode(mode);
+    auto root = m_stage->GetPrimAtPath(SdfPath("/root"));
+    {
+      ScopedTransaction transaction(m_stage, m_stage->GetSessionLayer());
+      EXPECT_TRUE(root.GetRelationship(TfToken("rel")).AddTarget(SdfPath("/root/A")));
+      EXPECT_TRUE(root.GetAttribute(TfToken("prop")).AddConnection(SdfPath("/root/A.prop")));
+    }
+    EXPECT_EQ(sorted(getChanged()), sorted({"/root.prop", "/root.rel"}));
+    EXPECT_EQ(sorted(getResynced()), empty());
+    {
+      ScopedTransaction transaction(m_stage, m_stage->GetSessionLayer());
+      EXPECT_TRUE(root.GetRelationship(TfToken("rel")).ClearTargets(false));
+    }
+    EXPECT_EQ(sorted(getChanged()), sorted({"/root.rel"}));
+    EXPECT_EQ(sorted(getResynced()), empty());
+    {
+      ScopedTransaction transaction(m_stage, m_stage->GetSessionLayer());
+      EXPECT_TRUE(root.GetAttribute(TfToken("prop")).ClearConnections());
+    }
+    EXPECT_EQ(sorted(getChanged()), sorted({"/root.prop"}));
+    EXPECT_EQ(sorted(getResynced()), empty());
+  }
+}
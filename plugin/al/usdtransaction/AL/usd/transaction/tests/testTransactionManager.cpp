@@ -3,10 +3,16 @@
 #include "AL/usd/transaction/TransactionManager.h"
 
 #include <pxr/pxr.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/usd/sdf/attributeSpec.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/primSpec.h>
 #include <pxr/usd/usd/stage.h>
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 using namespace AL::usd::transaction;
 PXR_NAMESPACE_USING_DIRECTIVE
 
@@ -117,3 +123,60 @@ TEST_F(TransactionManagerTest, InProgress_Layer)
   EXPECT_FALSE(TransactionManager::InProgress(stage, layerA));
   EXPECT_FALSE(TransactionManager::InProgress(stage, layerB));
 }
+
+/// Test that journal and full comparison report same changes for a small edit across layer sizes
+TEST_F(TransactionManagerTest, JournalMatchesDiff)
+{
+  struct Listener : public TfWeakBase
+  {
+    void closeNotification(const CloseNotice& notice, const UsdStageWeakPtr&)
+    {
+      changed = notice.GetChangedInfoOnlyPaths();
+      resynced = notice.GetResyncedPaths();
+      std::sort(changed.begin(), changed.end());
+      std::sort(resynced.begin(), resynced.end());
+    }
+    SdfPathVector changed, resynced;
+  };
+
+  const auto previousMode = TransactionManager::GetTrackingMode();
+  auto stage = UsdStage::CreateInMemory();
+  Listener listener;
+  auto key = TfNotice::Register(TfCreateWeakPtr(&listener), &Listener::closeNotification, stage);
+
+  for (size_t numPrims : {1000u, 10000u})
+  {
+    auto layer = SdfLayer::CreateAnonymous();
+    {
+      SdfChangeBlock block;
+      for (size_t i = 0; i < numPrims; ++i)
+      {
+        auto prim = SdfPrimSpec::New(layer->GetPseudoRoot(), TfStringPrintf("prim_%zu", i), SdfSpecifierDef);
+        auto attr = SdfAttributeSpec::New(prim, "prop", SdfValueTypeNames->Int);
+        attr->SetDefaultValue(VtValue(int(i)));
+      }
+    }
+
+    SdfPathVector results[2][2];
+    const TransactionManager::TrackingMode modes[2] = {TransactionManager::TrackingMode::kJournal,
+                                                       TransactionManager::TrackingMode::kDiff};
+    for (int m = 0; m < 2; ++m)
+    {
+      TransactionManager::SetTrackingMode(modes[m]);
+      EXPECT_TRUE(TransactionManager::Open(stage, layer));
+      auto attr = layer->GetAttributeAtPath(SdfPath(TfStringPrintf("/prim_%zu.prop", numPrims / 2)));
+      attr->SetDefaultValue(VtValue(int(m + numPrims)));
+      SdfPrimSpec::New(layer->GetPseudoRoot(), TfStringPrintf("added_%d", m), SdfSpecifierDef);
+      EXPECT_TRUE(TransactionManager::Close(stage, layer));
+      results[m][0] = listener.changed;
+      results[m][1] = listener.resynced;
+      std::replace(results[m][1].begin(), results[m][1].end(),
+                   SdfPath(TfStringPrintf("/added_%d", m)), SdfPath("/added"));
+    }
+    EXPECT_EQ(results[0][0], results[1][0]);
+    EXPECT_EQ(results[0][1], results[1][1]);
+  }
+
+  TfNotice::Revoke(key);
+  TransactionManager::SetTrackingMode(previousMode);
+}
@@ -50,7 +50,7 @@ static bool CloseStageLayer(const UsdStageWeakPtr& stage, const SdfLayerHandle&
 void wrapTransactionManager()
 {
   {
-    class_<This>("TransactionManager", no_init)
+    scope s = class_<This>("TransactionManager", no_init)
       .def("InProgress", InProgressStage, (arg("stage")))
       .def("InProgress", InProgressStageLayer, (arg("stage"), arg("layer")))
       .staticmethod("InProgress")
@@ -60,6 +60,18 @@ void wrapTransactionManager()
 
       .def("Close", CloseStageLayer, (arg("stage"), arg("layer")))
       .staticmethod("Close")
+
+      .def("SetTrackingMode", &This::SetTrackingMode, (arg("mode")))
+      .staticmethod("SetTrackingMode")
+
+      .def("GetTrackingMode", &This::GetTrackingMode)
+      .staticmethod("GetTrackingMode")
+    ;
+
+    enum_<This::TrackingMode>("TrackingMode")
+      .value("Journal", This::TrackingMode::kJournal)
+      .value("Diff", This::TrackingMode::kDiff)
+      .value("Validate", This::TrackingMode::kValidate)
     ;
   }
 }
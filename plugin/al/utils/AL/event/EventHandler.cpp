@@ -73,6 +73,16 @@ Callback::~Callback()
   }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void EventDispatcher::compileScript(Callback& callback)
+{
+  // MEL has no means to precompile, so only python callbacks are compiled up front
+  if(callback.isPythonCallback() && !callback.m_compiledScript)
+  {
+    callback.m_compiledScript = m_system->compilePython(callback.callbackText(), callback.tag().c_str());
+  }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 Callback EventDispatcher::buildCallbackInternal(
   const char* const tag,
@@ -146,7 +156,8 @@ CallbackId EventDispatcher::registerCallback(
     newId = std::max(newId, it->callbackId());
   }
 
-  m_callbacks.emplace(insertLocation, tag, commandText, weight, isPython, ++newId);
+  auto inserted = m_callbacks.emplace(insertLocation, tag, commandText, weight, isPython, ++newId);
+  compileScript(*inserted);
   return newId;
 }
 
@@ -190,6 +201,7 @@ void EventDispatcher::registerCallback(Callback& info)
       return;
     }
   }
+  compileScript(info);
   m_callbacks.insert(insertLocation, std::move(info));
 }
 
@@ -268,6 +280,7 @@ bool EventScheduler::unregisterEvent(EventId eventId)
   {
     if(it->eventId() == eventId)
     {
+      dropDeferredEvent(eventId);
       m_registeredEvents.erase(it);
       return true;
     }
@@ -283,6 +296,7 @@ bool EventScheduler::unregisterEvent(const char* const eventName)
     if(it->name() == eventName &&
        it->associatedData() == 0)
     {
+      dropDeferredEvent(it->eventId());
       m_registeredEvents.erase(it);
       return true;
     }
@@ -290,6 +304,75 @@ bool EventScheduler::unregisterEvent(const char* const eventName)
   return false;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void EventScheduler::dropDeferredEvent(EventId eventId)
+{
+  // event ids are recycled, so make sure a queued dispatch can't end up on a newly registered event
+  auto it = m_deferredEventIndices.find(eventId);
+  if(it != m_deferredEventIndices.end())
+  {
+    m_deferredEvents[it->second].eventId = InvalidEventId;
+    m_deferredEventIndices.erase(it);
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void EventScheduler::deferEvent(EventDispatcher& dispatcher, DeferredBinder&& binder)
+{
+  auto inserted = m_deferredEventIndices.emplace(dispatcher.eventId(), m_deferredEvents.size());
+  if(inserted.second)
+  {
+    m_deferredEvents.push_back(DeferredEvent{ dispatcher.eventId(), std::move(binder) });
+  }
+  else
+  {
+    m_deferredEvents[inserted.first->second].binder = std::move(binder);
+    ++dispatcher.m_coalescedCount;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void EventScheduler::beginEditBlock()
+{
+  ++m_editBlockDepth;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void EventScheduler::endEditBlock()
+{
+  if(!m_editBlockDepth)
+  {
+    m_system->error("EventScheduler::endEditBlock called without a matching beginEditBlock");
+    return;
+  }
+  if(--m_editBlockDepth)
+  {
+    return;
+  }
+
+  // callbacks are free to raise more events (or open new blocks), so take ownership of the queue before dispatching
+  std::vector<DeferredEvent> deferredEvents;
+  deferredEvents.swap(m_deferredEvents);
+  m_deferredEventIndices.clear();
+
+  for(auto& deferred : deferredEvents)
+  {
+    EventDispatcher* dispatcher = event(deferred.eventId);
+    if(!dispatcher)
+    {
+      continue;
+    }
+    if(deferred.binder)
+    {
+      dispatcher->triggerEvent(deferred.binder);
+    }
+    else
+    {
+      dispatcher->triggerEvent();
+    }
+  }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 EventDispatcher* EventScheduler::event(EventId eventId)
 {
@@ -21,6 +21,9 @@
 #include <vector>
 #include <unordered_map>
 #include <cstdarg>
+#include <chrono>
+#include <functional>
+#include <memory>
 
 namespace AL {
 namespace event {
@@ -183,6 +186,21 @@ public:
   /// \return true if executed correctly
   virtual bool executeMEL(const char* const code) = 0;
 
+  /// \brief  override to compile python code once, when a python callback is registered. The returned handle is
+  ///         handed to executeCompiledPython each time the callback is triggered. The default implementation returns
+  ///         null, in which case the callback text is passed to executePython instead.
+  /// \param  code the code to compile
+  /// \param  tag the tag of the callback that owns the code (used when reporting errors)
+  /// \return a handle to the compiled code, or null if the code could not be compiled
+  virtual std::shared_ptr<void> compilePython(const char* const code, const char* const tag)
+    { return std::shared_ptr<void>(); }
+
+  /// \brief  override to execute python code previously returned from compilePython
+  /// \param  compiled the handle returned from compilePython
+  /// \return true if executed correctly
+  virtual bool executeCompiledPython(const void* compiled)
+    { return false; }
+
   /// \brief  override to implement the logging system
   /// \param  severity
   /// \param  text the text to log
@@ -283,7 +301,8 @@ public:
   /// \brief  move ctor
   /// \param  rhs the rvalue to move
   Callback(Callback&& rhs)
-    : m_tag(std::move(rhs.m_tag)), m_userData(rhs.m_userData), m_callbackId(rhs.m_callbackId)
+    : m_tag(std::move(rhs.m_tag)), m_userData(rhs.m_userData), m_callbackId(rhs.m_callbackId),
+      m_compiledScript(std::move(rhs.m_compiledScript))
   {
     m_callback = rhs.m_callback;
     rhs.m_callback = nullptr;
@@ -299,6 +318,7 @@ public:
       m_tag = std::move(rhs.m_tag);
       m_userData = rhs.m_userData;
       m_callbackId = rhs.m_callbackId;
+      m_compiledScript = std::move(rhs.m_compiledScript);
       m_callback = rhs.m_callback;
       rhs.m_callback = nullptr;
       m_weight = rhs.m_weight;
@@ -361,10 +381,15 @@ public:
   bool isCCallback() const
     { return m_functionType == kCFunction; }
 
+  /// \brief  returns the handle to the precompiled script code (or null if the code has not been compiled)
+  const void* compiledScript() const
+    { return m_compiledScript.get(); }
+
 private:
   std::string m_tag;
   void* m_userData;
   CallbackId m_callbackId;
+  std::shared_ptr<void> m_compiledScript;
   union
   {
     const void* m_callback;
@@ -407,7 +432,10 @@ public:
       m_associatedData(associatedData),
       m_parentCallback(parentCallback),
       m_eventId(eventId),
-      m_eventType(eventType)
+      m_eventType(eventType),
+      m_triggerCount(0),
+      m_coalescedCount(0),
+      m_triggerTime(0)
     {}
 
   /// \brief  move ctor
@@ -419,7 +447,10 @@ public:
       m_associatedData(rhs.m_associatedData),
       m_parentCallback(rhs.m_parentCallback),
       m_eventId(rhs.m_eventId),
-      m_eventType(rhs.m_eventType)
+      m_eventType(rhs.m_eventType),
+      m_triggerCount(rhs.m_triggerCount),
+      m_coalescedCount(rhs.m_coalescedCount),
+      m_triggerTime(rhs.m_triggerTime)
     {}
 
   /// \brief  move assignment
@@ -434,6 +465,9 @@ public:
       m_parentCallback = rhs.m_parentCallback;
       m_eventId = rhs.m_eventId;
       m_eventType = rhs.m_eventType;
+      m_triggerCount = rhs.m_triggerCount;
+      m_coalescedCount = rhs.m_coalescedCount;
+      m_triggerTime = rhs.m_triggerTime;
       return *this;
     }
 
@@ -577,6 +611,7 @@ public:
   template<typename FunctionBinder>
   void triggerEvent(FunctionBinder binder)
   {
+    const auto start = std::chrono::steady_clock::now();
     for(auto& callback : m_callbacks)
     {
       if(callback.isCCallback())
@@ -584,23 +619,12 @@ public:
         binder(callback.userData(), callback.callback());
       }
       else
-      if(callback.isPythonCallback())
-      {
-        if(!m_system->executePython(callback.callbackText()))
-        {
-          m_system->error("The python callback of event name \"%s\" and tag \"%s\" failed to execute correctly",
-              m_name.c_str(), callback.tag().c_str());
-        }
-      }
-      else
       {
-        if(!m_system->executeMEL(callback.callbackText()))
-        {
-          m_system->error("The MEL callback of event name \"%s\" and tag \"%s\" failed to execute correctly",
-              m_name.c_str(), callback.tag().c_str());
-        }
+        executeScript(callback);
       }
     }
+    ++m_triggerCount;
+    m_triggerTime += std::chrono::steady_clock::now() - start;
   }
 
   /// \brief  a default version of dispatchEvent that assumes a function callback type of
@@ -609,32 +633,34 @@ public:
   /// \endcode
   void triggerEvent()
   {
-    for(auto& callback : m_callbacks)
+    triggerEvent([](void* userData, const void* callback) {
+        ((defaultEventFunction)callback)(userData);
+      });
+  }
+
+  /// \brief  returns the number of times this event has been dispatched to its callbacks
+  /// \return the number of times the event has been dispatched
+  uint64_t triggerCount() const
+    { return m_triggerCount; }
+
+  /// \brief  returns the number of times this event was raised within an edit block, and merged into a dispatch that
+  ///         had already been queued (see EventScheduler::beginEditBlock)
+  /// \return the number of coalesced triggers
+  uint64_t coalescedCount() const
+    { return m_coalescedCount; }
+
+  /// \brief  returns the total time spent executing the callbacks of this event
+  /// \return the accumulated time spent in the callbacks
+  std::chrono::nanoseconds triggerTime() const
+    { return m_triggerTime; }
+
+  /// \brief  resets the trigger count, coalesced count, and trigger time back to zero
+  void resetStatistics()
     {
-      if(callback.isCCallback())
-      {
-        defaultEventFunction basic = (defaultEventFunction)callback.callback();
-        basic(callback.userData());
-      }
-      else
-      if(callback.isPythonCallback())
-      {
-        if(!m_system->executePython(callback.callbackText()))
-        {
-          m_system->error("The python callback of event name \"%s\" and tag \"%s\" failed to execute correctly",
-              m_name.c_str(), callback.tag().c_str());
-        }
-      }
-      else
-      {
-        if(!m_system->executeMEL(callback.callbackText()))
-        {
-          m_system->error("The MEL callback of event name \"%s\" and tag \"%s\" failed to execute correctly",
-              m_name.c_str(), callback.tag().c_str());
-        }
-      }
+      m_triggerCount = 0;
+      m_coalescedCount = 0;
+      m_triggerTime = std::chrono::nanoseconds(0);
     }
-  }
 
   /// \brief  used to sort the events based on their ID
   /// \param  eventId the event id to compare to
@@ -671,6 +697,30 @@ public:
     }
 
 private:
+  void executeScript(const Callback& callback)
+  {
+    if(callback.isPythonCallback())
+    {
+      const bool result = callback.compiledScript() ?
+                          m_system->executeCompiledPython(callback.compiledScript()) :
+                          m_system->executePython(callback.callbackText());
+      if(!result)
+      {
+        m_system->error("The python callback of event name \"%s\" and tag \"%s\" failed to execute correctly",
+            m_name.c_str(), callback.tag().c_str());
+      }
+    }
+    else
+    {
+      if(!m_system->executeMEL(callback.callbackText()))
+      {
+        m_system->error("The MEL callback of event name \"%s\" and tag \"%s\" failed to execute correctly",
+            m_name.c_str(), callback.tag().c_str());
+      }
+    }
+  }
+  AL_EVENT_PUBLIC
+  void compileScript(Callback& callback);
   AL_EVENT_PUBLIC
   CallbackId registerCallbackInternal(
     const char* const tag,
@@ -691,6 +741,9 @@ private:
   CallbackId m_parentCallback;
   EventId m_eventId;
   EventType m_eventType;
+  uint64_t m_triggerCount;
+  uint64_t m_coalescedCount;
+  std::chrono::nanoseconds m_triggerTime;
 };
 typedef std::vector<EventDispatcher> EventDispatchers;
 
@@ -721,7 +774,7 @@ public:
   /// \brief  ctor
   /// \param  system The object that provides a binding to the underlying DCC system utilities
   EventScheduler(EventSystemBinding* system)
-    : m_system(system), m_registeredEvents() {}
+    : m_system(system), m_registeredEvents(), m_editBlockDepth(0) {}
 
   /// \brief  dtor
   AL_EVENT_PUBLIC
@@ -826,6 +879,70 @@ public:
     return false;
   }
 
+  /// \brief  dispatches an event using a function binder. If called within an edit block, the event will be queued and
+  ///         dispatched when the outermost block ends. Raising the same event more than once within a block results in
+  ///         a single dispatch that uses the binder passed with the last trigger, so the binder must not refer to
+  ///         anything that will go out of scope before the block ends.
+  /// \param  eventId the event to dispatch
+  /// \param  binder the binder to dispatch the event
+  /// \return true if the event is valid
+  template<typename FunctionBinder>
+  bool triggerOrDeferEvent(EventId eventId, FunctionBinder binder)
+  {
+    EventDispatcher* e = event(eventId);
+    if(e)
+    {
+      if(m_editBlockDepth)
+      {
+        deferEvent(*e, DeferredBinder(binder));
+      }
+      else
+      {
+        e->triggerEvent(binder);
+      }
+      return true;
+    }
+    return false;
+  }
+
+  /// \brief  dispatches an event using the standard void (*func)(void* userData) signature, or queues it if called
+  ///         within an edit block.
+  /// \param  eventId the event to dispatch
+  /// \return true if the event is valid
+  bool triggerOrDeferEvent(EventId eventId)
+  {
+    EventDispatcher* e = event(eventId);
+    if(e)
+    {
+      if(m_editBlockDepth)
+      {
+        deferEvent(*e, DeferredBinder());
+      }
+      else
+      {
+        e->triggerEvent();
+      }
+      return true;
+    }
+    return false;
+  }
+
+  /// \brief  Starts an edit block. Until the matching call to endEditBlock, events raised via triggerOrDeferEvent are
+  ///         queued rather than dispatched. Each event is queued at most once, so an event raised repeatedly (e.g.
+  ///         once per prim during a resync) only has its callbacks run once. Blocks may be nested, in which case the
+  ///         queued events are dispatched when the outermost block ends.
+  AL_EVENT_PUBLIC
+  void beginEditBlock();
+
+  /// \brief  Ends an edit block. If this is the outermost block, all of the queued events are dispatched in the order
+  ///         they were first raised.
+  AL_EVENT_PUBLIC
+  void endEditBlock();
+
+  /// \brief  returns true if the scheduler is currently within an edit block
+  bool isInEditBlock() const
+    { return m_editBlockDepth != 0; }
+
   /// \brief  register a new event callback
   /// \param  eventId the event id
   /// \param  tag the tag for the callback
@@ -1044,10 +1161,49 @@ public:
   void registerHandler(EventType type, CustomEventHandler* handler)
     { m_customHandlers[type] = handler; }
 
+private:
+  typedef std::function<void(void*, const void*)> DeferredBinder;
+  struct DeferredEvent
+  {
+    EventId eventId;
+    DeferredBinder binder; ///< null when the event uses the default callback signature
+  };
+  AL_EVENT_PUBLIC
+  void deferEvent(EventDispatcher& dispatcher, DeferredBinder&& binder);
+  AL_EVENT_PUBLIC
+  void dropDeferredEvent(EventId eventId);
 private:
   EventSystemBinding* m_system;
   EventDispatchers m_registeredEvents;
   std::unordered_map<EventType, CustomEventHandler*> m_customHandlers;
+  std::vector<DeferredEvent> m_deferredEvents;
+  std::unordered_map<EventId, size_t> m_deferredEventIndices;
+  uint32_t m_editBlockDepth;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  A utility that opens an edit block on an event scheduler for the duration of its scope.
+/// \ingroup events
+//----------------------------------------------------------------------------------------------------------------------
+class EventEditBlock
+{
+public:
+
+  /// \brief  ctor
+  /// \param  scheduler the event scheduler in which to open an edit block
+  EventEditBlock(EventScheduler& scheduler = EventScheduler::getScheduler())
+    : m_scheduler(scheduler)
+    { m_scheduler.beginEditBlock(); }
+
+  /// \brief  dtor - ends the edit block, dispatching any queued events if this was the outermost block
+  ~EventEditBlock()
+    { m_scheduler.endEditBlock(); }
+
+  EventEditBlock(const EventEditBlock&) = delete;
+  EventEditBlock& operator = (const EventEditBlock&) = delete;
+
+private:
+  EventScheduler& m_scheduler;
 };
 
 class NodeEvents;
@@ -1088,6 +1244,24 @@ public:
     return false;
   }
 
+  /// \brief  trigger the event of the given name, or queue it if the scheduler is within an edit block (see
+  ///         EventScheduler::beginEditBlock). Only use this for events that callbacks don't expect to be paired with
+  ///         another one, Pre/Post events should always be triggered immediately with triggerEvent.
+  /// \param  eventName the name of the event to trigger on this node
+  /// \return true if the event is valid
+  bool triggerOrDeferEvent(const char* const eventName)
+  {
+    auto it = m_events.find(eventName);
+    if(it !=  m_events.end())
+    {
+      return m_scheduler->triggerOrDeferEvent(it->second,
+          [this](void* userData, const void* callback) {
+              ((node_dispatch_func)callback)(userData, this);
+          });
+    }
+    return false;
+  }
+
   /// \brief  dtor
   virtual ~NodeEvents()
   {
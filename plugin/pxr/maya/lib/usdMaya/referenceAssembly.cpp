@@ -16,6 +16,7 @@
 #include "usdMaya/referenceAssembly.h"
 
 #include "usdMaya/editUtil.h"
+#include <mayaUsd/base/debugCodes.h>
 #include <mayaUsd/fileio/jobs/jobArgs.h>
 #include <mayaUsd/listeners/notice.h>
 #include "usdMaya/proxyShape.h"
@@ -26,11 +27,14 @@
 #include <mayaUsd/render/pxrUsdMayaGL/instancerImager.h>
 #include "usdMaya/instancerShapeAdapterWithSceneAssembly.h"
 
+#include <pxr/base/tf/debug.h>
 #include <pxr/base/tf/fileUtils.h>
 #include <pxr/base/tf/registryManager.h>
 #include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/work/loops.h>
 
 #include <pxr/usd/ar/resolver.h>
+#include <pxr/usd/ar/resolverContextBinder.h>
 #include <pxr/usd/usd/editContext.h>
 #include <pxr/usd/usd/editTarget.h>
 #include <pxr/usd/usd/stageCacheContext.h>
@@ -64,7 +68,9 @@
 #include <algorithm>
 #include <map>
 #include <set>
+#include <sstream>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 
@@ -1156,6 +1162,220 @@ UsdMayaReferenceAssembly::DisconnectAssemblyTimeFromMayaTime()
     dgMod.doIt();
 }
 
+namespace {
+
+// Everything that determines the stage an assembly will compose when one of
+// its representations is activated.
+struct _StagePrefetch
+{
+    std::string filePath;
+    std::string primPath;
+    std::map<std::string, std::string> variantSelections;
+    TfToken drawMode;
+    bool forReadJob;
+};
+
+static
+std::string
+_GetStagePrefetchKey(const _StagePrefetch& prefetch)
+{
+    std::ostringstream key;
+    key << prefetch.filePath << ":" << prefetch.primPath << ":";
+    for (const auto& pair : prefetch.variantSelections) {
+        key << pair.first << "=" << pair.second << "|";
+    }
+    key << ":" << prefetch.drawMode << ":" << prefetch.forReadJob;
+    return key.str();
+}
+
+// Composes the stages for the given prefetch into the UsdMayaStageCache, the
+// same way computeInStageDataCached() and the read job would, so that they
+// find them in the cache. This only touches USD, so it is safe to call from
+// worker threads.
+static
+std::vector<UsdStageRefPtr>
+_PrefetchStages(
+        const _StagePrefetch& prefetch,
+        const ArResolverContext& resolverContext)
+{
+    std::vector<UsdStageRefPtr> stages;
+
+    // The resolver context binding is per thread, so rebind the one that was
+    // current when the batch was started.
+    ArResolverContextBinder binder(resolverContext);
+
+    SdfLayerRefPtr rootLayer = SdfLayer::FindOrOpen(prefetch.filePath);
+    if (!rootLayer) {
+        return stages;
+    }
+
+    const TfToken modelName = UsdUtilsGetModelNameFromRootLayer(rootLayer);
+    SdfLayerRefPtr sessionLayer =
+            UsdMayaStageCache::GetSharedSessionLayer(
+                SdfPath::AbsoluteRootPath().AppendChild(modelName),
+                prefetch.variantSelections,
+                prefetch.drawMode);
+
+    const bool loadAll = true;
+    UsdStageCacheContext ctx(UsdMayaStageCache::Get(loadAll));
+    UsdStageRefPtr usdStage = UsdStage::Open(rootLayer,
+                                             sessionLayer,
+                                             resolverContext);
+    if (!usdStage) {
+        return stages;
+    }
+    stages.push_back(usdStage);
+
+    if (!prefetch.forReadJob) {
+        return stages;
+    }
+
+    // The read job only applies the selections for variant sets that exist
+    // on the assembly's prim (see GetVariantSetSelections()).
+    UsdPrim usdPrim = prefetch.primPath.empty() ?
+        usdStage->GetDefaultPrim() :
+        usdStage->GetPrimAtPath(SdfPath(prefetch.primPath));
+    if (!usdPrim) {
+        return stages;
+    }
+
+    std::vector<std::pair<std::string, std::string> > varSelsVec;
+    const std::vector<std::string> variantSetNames =
+        usdPrim.GetVariantSets().GetNames();
+    for (const std::string& variantSetName : variantSetNames) {
+        const auto it = prefetch.variantSelections.find(variantSetName);
+        if (it != prefetch.variantSelections.end()) {
+            varSelsVec.push_back(*it);
+        }
+    }
+
+    SdfLayerRefPtr readJobSessionLayer =
+        UsdUtilsStageCache::GetSessionLayerForVariantSelections(modelName,
+                                                                varSelsVec);
+    UsdStageRefPtr readJobStage = UsdStage::Open(rootLayer,
+                                                 readJobSessionLayer,
+                                                 UsdStage::LoadAll);
+    if (readJobStage) {
+        stages.push_back(readJobStage);
+    }
+
+    return stages;
+}
+
+} // anonymous namespace
+
+/* static */
+size_t
+UsdMayaReferenceAssembly::ActivateRepresentations(
+        const std::vector<MObject>& assemblies,
+        const MString& representation,
+        MDGModifier& modifier)
+{
+    MStatus status;
+
+    std::vector<_StagePrefetch> prefetches;
+    std::unordered_set<std::string> prefetchKeys;
+    std::vector<MString> assemblyPaths;
+
+    for (const MObject& assemObj : assemblies) {
+        MFnAssembly assemblyFn(assemObj, &status);
+        if (status != MS::kSuccess || assemblyFn.typeId() != typeId) {
+            TF_WARN("Skipping activation of '%s', which is not a %s node",
+                    MFnDependencyNode(assemObj).name().asChar(),
+                    UsdMayaReferenceAssemblyTokens->MayaTypeName.GetText());
+            continue;
+        }
+        assemblyPaths.push_back(assemblyFn.fullPathName());
+
+        // Nested assemblies get their stage from their parent, and
+        // assemblies with edits do not share their session layer.
+        const MPlug inStageDataPlug = assemblyFn.findPlug(inStageDataAttr, true);
+        if (inStageDataPlug.isConnected() ||
+                !_GetEdits(assemObj).isDone()) {
+            continue;
+        }
+
+        _StagePrefetch prefetch;
+        prefetch.filePath = TfStringTrimRight(
+            assemblyFn.findPlug(filePathAttr, true).asString().asChar());
+        if (prefetch.filePath.empty()) {
+            continue;
+        }
+        prefetch.primPath =
+            assemblyFn.findPlug(primPathAttr, true).asString().asChar();
+
+        const std::set<std::string> varSetNamesForCache =
+            _GetVariantSetNamesForStageCache(assemblyFn);
+        for (const std::string& variantSet : varSetNamesForCache) {
+            MString variantSetPlugName(
+                UsdMayaVariantSetTokens->PlugNamePrefix.GetText());
+            variantSetPlugName += variantSet.c_str();
+            MPlug varSetPlg = assemblyFn.findPlug(variantSetPlugName, true);
+            if (!varSetPlg.isNull()) {
+                MString varSetVal = varSetPlg.asString();
+                if (varSetVal.length() > 0) {
+                    prefetch.variantSelections[variantSet] = varSetVal.asChar();
+                }
+            }
+        }
+
+        MPlug drawModePlug = assemblyFn.findPlug(drawModeAttr, true);
+        if (!drawModePlug.isNull()) {
+            prefetch.drawMode = TfToken(drawModePlug.asString().asChar());
+        }
+
+        const MString repType = assemblyFn.getRepType(representation);
+        prefetch.forReadJob =
+            repType == UsdMayaRepresentationExpanded::_assemblyType ||
+            repType == UsdMayaRepresentationFull::_assemblyType;
+
+        if (prefetchKeys.insert(_GetStagePrefetchKey(prefetch)).second) {
+            prefetches.push_back(std::move(prefetch));
+        }
+    }
+
+    // Make sure the stage caches exist before they are used from other
+    // threads.
+    UsdMayaStageCache::Get(true);
+    UsdMayaStageCache::Get(false);
+
+    const ArResolverContext resolverContext =
+        ArGetResolver().GetCurrentContext();
+    std::vector<std::vector<UsdStageRefPtr> > prefetchedStages(
+        prefetches.size());
+    WorkParallelForN(
+        prefetches.size(),
+        [&prefetches, &prefetchedStages, &resolverContext](
+                size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                prefetchedStages[i] =
+                    _PrefetchStages(prefetches[i], resolverContext);
+            }
+        });
+
+    TF_DEBUG(PXRUSDMAYA_REFERENCE_ASSEMBLY).Msg(
+        "Prefetched %zu unique USD stages for %zu assemblies\n",
+        prefetches.size(),
+        assemblyPaths.size());
+
+    // Activation creates Maya nodes, which has to happen on the main thread.
+    // Queue it in the original order so that parents are activated before
+    // any of their children.
+    for (const MString& assemblyPath : assemblyPaths) {
+        MString cmd;
+        cmd.format(
+            "assembly -edit -active \"^1s\" \"^2s\"",
+            representation,
+            assemblyPath);
+        modifier.commandToExecute(cmd);
+    }
+
+    status = modifier.doIt();
+    CHECK_MSTATUS_AND_RETURN(status, 0u);
+
+    return assemblyPaths.size();
+}
+
 // =========================================================
 
 UsdMayaRepresentationBase::UsdMayaRepresentationBase(
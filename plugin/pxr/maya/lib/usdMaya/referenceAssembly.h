@@ -227,6 +227,28 @@ public:
     PXRUSDMAYA_API
     void DisconnectAssemblyTimeFromMayaTime();
 
+    /// Activate \p representation on all of the given assemblies at once.
+    ///
+    /// Activating assemblies one at a time composes a USD stage for each of
+    /// them in turn. Instead, this function first groups the assemblies by
+    /// the stage they will request, i.e. by file, variant selections and draw
+    /// mode, and composes each unique stage once, in parallel, into the
+    /// UsdMayaStageCache. For the Expanded and Full representations the stage
+    /// opened by the read job is prefetched as well. The activations are then
+    /// queued on \p modifier and executed in order by a single doIt(), so the
+    /// whole batch can be undone as one operation.
+    ///
+    /// Assemblies that have edits or that receive their stage from a parent
+    /// assembly do not share stages, so they are activated without
+    /// prefetching.
+    ///
+    /// Returns the number of assemblies that were queued for activation.
+    PXRUSDMAYA_API
+    static size_t ActivateRepresentations(
+            const std::vector<MObject>& assemblies,
+            const MString& representation,
+            MDGModifier& modifier);
+
   private:
 
     friend class UsdMayaRepresentationBase;
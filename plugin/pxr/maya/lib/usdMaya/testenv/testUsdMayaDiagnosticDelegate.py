@@ -133,8 +133,8 @@ class testUsdMayaDiagnosticDelegate(unittest.TestCase):
                 pass
         log = self._StopRecording()
 
-        # Note: we use assertItemsEqual because coalescing may re-order the
-        # diagnostic messages.
+        # Note: we use assertItemsEqual because statuses are reported before
+        # warnings.
         self.assertItemsEqual(log, [
             ("spooky warning", OM.MCommandMessage.kWarning),
             ("informative status", OM.MCommandMessage.kInfo),
@@ -142,6 +142,22 @@ class testUsdMayaDiagnosticDelegate(unittest.TestCase):
             ("spam warning 0 -- and 2 similar", OM.MCommandMessage.kWarning)
         ])
 
+    def testBatching_ManyDiagnostics(self):
+        """Tests that diagnostics from the same call site are counted, not
+        all kept, and are reported in the order they were first issued."""
+        self._StartRecording()
+        with mayaUsdLib.DiagnosticBatchContext():
+            for i in range(10000):
+                Tf.Warn("flood warning %d" % i)
+            Tf.Warn("last warning")
+        log = self._StopRecording()
+
+        self.assertListEqual(log, [
+            ("flood warning 0 -- and 9999 similar",
+                OM.MCommandMessage.kWarning),
+            ("last warning", OM.MCommandMessage.kWarning)
+        ])
+
     @unittest.skip("Skip due to issue with unloading pxrUsd, see bug 161884")
     def testBatching_DelegateRemoved(self):
         """Tests removing the diagnostic delegate when the batch context is
@@ -16,6 +16,7 @@
 #
 
 from pxr import UsdGeom
+from pxr import UsdMaya
 
 import mayaUsd.lib as mayaUsdLib
 
@@ -297,6 +298,59 @@ class testUsdReferenceAssemblyChangeRepresentations(unittest.TestCase):
         cmds.assembly(assemblyNodeNoPrimPath, edit=True, active='Full')
         self._ValidateUnloaded(assemblyNodeNoPrimPath)
 
+    def testBatchActivateRepresentations(self):
+        """
+        This tests that activating a representation on many USD reference
+        assembly nodes at once gives the same result as activating them one
+        at a time, that assemblies referencing the same asset share a USD
+        stage, and that the whole batch is undone as a single operation.
+        """
+        cmds.file(new=True, force=True)
+
+        usdFile = os.path.abspath('CubeModel.usda')
+
+        assemblyNodes = []
+        for i in range(4):
+            assemblyNode = cmds.assembly(name='BatchAssemblyNode%d' % i,
+                type=self.ASSEMBLY_TYPE_NAME)
+            cmds.setAttr("%s.filePath" % assemblyNode, usdFile, type='string')
+            cmds.setAttr("%s.primPath" % assemblyNode, '/CubeModel',
+                type='string')
+            assemblyNodes.append(assemblyNode)
+
+        numActivated = UsdMaya.ActivateRepresentations(assemblyNodes,
+            'Collapsed')
+        self.assertEqual(numActivated, len(assemblyNodes))
+        for assemblyNode in assemblyNodes:
+            self._ValidateCollapsed(assemblyNode)
+
+        # All of the assemblies use the same file and variant selections, so
+        # they should all be looking at the same stage.
+        stages = [mayaUsdLib.GetPrim(n).GetStage() for n in assemblyNodes]
+        for stage in stages[1:]:
+            self.assertEqual(stage, stages[0])
+
+        numActivated = UsdMaya.ActivateRepresentations(assemblyNodes,
+            'Expanded')
+        self.assertEqual(numActivated, len(assemblyNodes))
+        for assemblyNode in assemblyNodes:
+            self._ValidateModelExpanded(assemblyNode)
+
+        # Undo and all of the nodes should be back to Collapsed.
+        cmds.undo()
+        for assemblyNode in assemblyNodes:
+            self._ValidateCollapsed(assemblyNode)
+
+        # Undo once more and no representation should be active.
+        cmds.undo()
+        for assemblyNode in assemblyNodes:
+            self._ValidateUnloaded(assemblyNode)
+
+        # Redo and they are all back to Collapsed.
+        cmds.redo()
+        for assemblyNode in assemblyNodes:
+            self._ValidateCollapsed(assemblyNode)
+
     def testNestedAssemblyChangeReps(self):
         """
         This tests that changing representations of a USD reference assembly
@@ -16,10 +16,12 @@
 #include <pxr/pxr.h>
 #include "usdMaya/referenceAssembly.h"
 
+#include <mayaUsd/utils/undoHelperCommand.h>
 #include <mayaUsd/utils/util.h>
 
 #include <pxr/base/tf/pyContainerConversions.h>
 
+#include <maya/MDGModifier.h>
 #include <maya/MFnAssembly.h>
 #include <maya/MObject.h>
 #include <maya/MStatus.h>
@@ -28,6 +30,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 using namespace boost::python;
 
@@ -57,6 +60,34 @@ _GetVariantSetSelections(const std::string& assemblyName) {
     return assembly->GetVariantSetSelections();
 }
 
+static
+size_t
+_ActivateRepresentations(
+        const std::vector<std::string>& assemblyNames,
+        const std::string& representation)
+{
+    std::vector<MObject> assemblies;
+    assemblies.reserve(assemblyNames.size());
+    for (const std::string& assemblyName : assemblyNames) {
+        MObject assemblyObj;
+        MStatus status = UsdMayaUtil::GetMObjectByName(assemblyName,
+                                                          assemblyObj);
+        if (status != MS::kSuccess) {
+            TF_WARN("Could not find assembly node '%s'", assemblyName.c_str());
+            continue;
+        }
+        assemblies.push_back(assemblyObj);
+    }
+
+    return UsdMayaUndoHelperCommand::ExecuteWithUndo<size_t>(
+        [&assemblies, &representation](MDGModifier& modifier) {
+            return UsdMayaReferenceAssembly::ActivateRepresentations(
+                assemblies,
+                MString(representation.c_str()),
+                modifier);
+        });
+}
+
 } // anonymous namespace 
 
 void wrapAssembly()
@@ -64,4 +95,8 @@ void wrapAssembly()
     def("GetVariantSetSelections",
         &_GetVariantSetSelections,
         arg("assemblyName"));
+
+    def("ActivateRepresentations",
+        &_ActivateRepresentations,
+        (arg("assemblyNames"), arg("representation")));
 }
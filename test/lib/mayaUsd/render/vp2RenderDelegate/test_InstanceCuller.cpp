@@ -0,0 +1,153 @@
+#include <instanceCuller.h>
+
+#include <pxr/base/gf/frustum.h>
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/vt/types.h>
+
+#include <gtest/gtest.h>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+const int kViewportHeight = 100;
+
+//----------------------------------------------------------------------------------------------------------------------
+// Camera at the origin looking down -Z, with a 90 degrees field of view and a far plane at 100.
+GfFrustum makeFrustum()
+{
+  GfFrustum frustum;
+  frustum.SetPerspective(90.0, 1.0, 1.0, 100.0);
+  return frustum;
+}
+
+bool setView(HdVP2InstanceCuller& culler, const GfFrustum& frustum)
+{
+  const GfMatrix4d projection = frustum.ComputeProjectionMatrix();
+  return culler.SetView(frustum.ComputeViewMatrix() * projection, projection, GfVec3f(frustum.GetPosition()),
+                        kViewportHeight);
+}
+
+VtMatrix4dArray makeInstances(const std::vector<GfVec3d>& translations)
+{
+  VtMatrix4dArray transforms;
+  for (const GfVec3d& translation : translations)
+  {
+    transforms.push_back(GfMatrix4d(1.0).SetTranslate(translation));
+  }
+  return transforms;
+}
+
+// Unit cube, with a bounding sphere of radius 0.866
+const GfRange3d kUnitCube(GfVec3d(-0.5), GfVec3d(0.5));
+
+} // namespace
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(InstanceCuller, cullFrustum)
+{
+  HdVP2InstanceCuller culler(true, 0);
+  ASSERT_TRUE(setView(culler, makeFrustum()));
+  ASSERT_TRUE(culler.IsActive());
+
+  // 10 instances, so that both the 4-wide and the scalar loops are used.
+  const VtMatrix4dArray instances = makeInstances({
+    GfVec3d(0.0, 0.0, -10.0),   // 0: inside
+    GfVec3d(0.0, 0.0, 10.0),    // 1: behind the camera
+    GfVec3d(100.0, 0.0, -10.0), // 2: right of the view
+    GfVec3d(10.5, 0.0, -10.0),  // 3: straddling the right plane
+    GfVec3d(0.0, 0.0, -200.0),  // 4: beyond the far plane
+    GfVec3d(0.0, 5.0, -20.0),   // 5: inside
+    GfVec3d(0.0, 0.0, -100.5),  // 6: straddling the far plane
+    GfVec3d(12.0, 0.0, -10.0),  // 7: outside of the right plane by more than the radius
+    GfVec3d(0.0, -10.5, -10.0), // 8: straddling the bottom plane
+    GfVec3d(0.0, 0.0, -0.2),    // 9: straddling the near plane
+  });
+
+  std::vector<unsigned int> visible;
+  culler.Cull(kUnitCube, GfMatrix4d(1.0), instances, visible);
+  EXPECT_EQ(std::vector<unsigned int>({ 0, 3, 5, 6, 8, 9 }), visible);
+  EXPECT_EQ(size_t(6), culler.GetNumVisibleInstances());
+  EXPECT_EQ(size_t(4), culler.GetNumCulledInstances());
+
+  // The world matrix of the Rprim is applied before the instance transforms.
+  culler.Cull(kUnitCube, GfMatrix4d(1.0).SetTranslate(GfVec3d(0.0, 0.0, -20.0)), instances, visible);
+  EXPECT_EQ(std::vector<unsigned int>({ 0, 1, 3, 5, 7, 8, 9 }), visible);
+
+  // Buffers are reused by a smaller Rprim.
+  culler.ResetStatistics();
+  culler.Cull(kUnitCube, GfMatrix4d(1.0), makeInstances({ GfVec3d(0.0, 0.0, 10.0), GfVec3d(0.0, 0.0, -10.0) }), visible);
+  EXPECT_EQ(std::vector<unsigned int>({ 1 }), visible);
+  EXPECT_EQ(size_t(1), culler.GetNumVisibleInstances());
+  EXPECT_EQ(size_t(1), culler.GetNumCulledInstances());
+
+  // Without bounds all instances are kept.
+  culler.Cull(GfRange3d(), GfMatrix4d(1.0), instances, visible);
+  EXPECT_EQ(instances.size(), visible.size());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(InstanceCuller, cullMinPixels)
+{
+  // Spheres of radius 0.866 cover fewer than 10 pixels of a 100 pixels high viewport beyond a distance of 8.66.
+  HdVP2InstanceCuller culler(true, 10);
+  ASSERT_TRUE(setView(culler, makeFrustum()));
+
+  std::vector<unsigned int> visible;
+  culler.Cull(kUnitCube, GfMatrix4d(1.0),
+              makeInstances({ GfVec3d(0.0, 0.0, -5.0), GfVec3d(0.0, 0.0, -20.0), GfVec3d(0.0, 0.0, -8.0) }), visible);
+  EXPECT_EQ(std::vector<unsigned int>({ 0, 2 }), visible);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(InstanceCuller, viewChanges)
+{
+  HdVP2InstanceCuller disabled(false, 0);
+  EXPECT_FALSE(setView(disabled, makeFrustum()));
+  EXPECT_FALSE(disabled.IsActive());
+
+  HdVP2InstanceCuller culler(true, 0);
+  EXPECT_FALSE(culler.IsActive());
+
+  // Rprims are only synced again when the view actually changes.
+  GfFrustum frustum = makeFrustum();
+  EXPECT_TRUE(setView(culler, frustum));
+  EXPECT_FALSE(setView(culler, frustum));
+
+  frustum.SetPosition(GfVec3d(1.0, 0.0, 0.0));
+  EXPECT_TRUE(setView(culler, frustum));
+  EXPECT_FALSE(setView(culler, frustum));
+
+  // Several views deactivate culling once, and a single view reactivates it even if it didn't change.
+  EXPECT_TRUE(culler.SetMultipleViews());
+  EXPECT_FALSE(culler.IsActive());
+  EXPECT_FALSE(culler.SetMultipleViews());
+  EXPECT_TRUE(setView(culler, frustum));
+  EXPECT_TRUE(culler.IsActive());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(InstanceCuller, usdInstanceIndex)
+{
+  HdVP2InstanceCuller culler(true, 0);
+
+  // Without culled instances, draw and USD instance indices match.
+  EXPECT_EQ(3, culler.GetUsdInstanceIndex("item", 3));
+
+  culler.SetInstanceIndices("item", { 0, 3, 5 });
+  EXPECT_EQ(0, culler.GetUsdInstanceIndex("item", 0));
+  EXPECT_EQ(3, culler.GetUsdInstanceIndex("item", 1));
+  EXPECT_EQ(5, culler.GetUsdInstanceIndex("item", 2));
+
+  // Out of range and other render items are left alone.
+  EXPECT_EQ(3, culler.GetUsdInstanceIndex("item", 3));
+  EXPECT_EQ(-1, culler.GetUsdInstanceIndex("item", -1));
+  EXPECT_EQ(1, culler.GetUsdInstanceIndex("other", 1));
+
+  // An empty array means the instances are no longer culled.
+  culler.SetInstanceIndices("item", {});
+  EXPECT_EQ(1, culler.GetUsdInstanceIndex("item", 1));
+}
@@ -0,0 +1,170 @@
+#include <meshVertexLayout.h>
+
+#include <pxr/base/gf/vec2f.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/imaging/hd/tokens.h>
+#include <pxr/imaging/pxOsd/tokens.h>
+
+#include <gtest/gtest.h>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+//----------------------------------------------------------------------------------------------------------------------
+// Grid of size x size quads in the XY plane.
+HdMeshTopology makeGrid(int size)
+{
+  VtIntArray faceVertexCounts;
+  VtIntArray faceVertexIndices;
+  for (int y = 0; y < size; ++y)
+  {
+    for (int x = 0; x < size; ++x)
+    {
+      const int corner = y * (size + 1) + x;
+      faceVertexCounts.push_back(4);
+      faceVertexIndices.push_back(corner);
+      faceVertexIndices.push_back(corner + 1);
+      faceVertexIndices.push_back(corner + size + 2);
+      faceVertexIndices.push_back(corner + size + 1);
+    }
+  }
+  return HdMeshTopology(PxOsdOpenSubdivTokens->none, HdTokens->rightHanded, faceVertexCounts, faceVertexIndices);
+}
+
+// Face-varying uvs without seams: every face-vertex carries the uv of its point.
+VtVec2fArray makeGridUvs(const HdMeshTopology& topology, int size)
+{
+  VtVec2fArray uvs;
+  for (const int point : topology.GetFaceVertexIndices())
+  {
+    uvs.push_back(GfVec2f(float(point % (size + 1)) / size, float(point / (size + 1)) / size));
+  }
+  return uvs;
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(MeshVertexLayout, weldFaceVarying)
+{
+  const HdMeshTopology topology = makeGrid(4);
+
+  PrimvarSource source = { VtValue(makeGridUvs(topology, 4)), HdInterpolationFaceVarying };
+  EXPECT_TRUE(HdVP2WeldPrimvarSource(source, topology));
+  EXPECT_EQ(HdInterpolationVertex, source.interpolation);
+  ASSERT_TRUE(source.data.IsHolding<VtVec2fArray>());
+
+  const VtVec2fArray& uvs = source.data.UncheckedGet<VtVec2fArray>();
+  ASSERT_EQ(size_t(topology.GetNumPoints()), uvs.size());
+  EXPECT_EQ(GfVec2f(0.0f, 0.0f), uvs[0]);
+  EXPECT_EQ(GfVec2f(1.0f, 1.0f), uvs[24]);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(MeshVertexLayout, seamNotWelded)
+{
+  const HdMeshTopology topology = makeGrid(4);
+
+  // two face-vertices of point 1 with different uvs
+  VtVec2fArray uvs = makeGridUvs(topology, 4);
+  uvs[4] = GfVec2f(0.5f, 0.5f);
+
+  PrimvarSource source = { VtValue(uvs), HdInterpolationFaceVarying };
+  EXPECT_FALSE(HdVP2WeldPrimvarSource(source, topology));
+  EXPECT_EQ(HdInterpolationFaceVarying, source.interpolation);
+  EXPECT_EQ(uvs.size(), source.data.Get<VtVec2fArray>().size());
+
+  // unsupported value type
+  VtIntArray ids(topology.GetFaceVertexIndices().size(), 1);
+  source = { VtValue(ids), HdInterpolationFaceVarying };
+  EXPECT_FALSE(HdVP2WeldPrimvarSource(source, topology));
+  EXPECT_EQ(HdInterpolationFaceVarying, source.interpolation);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(MeshVertexLayout, weldUniform)
+{
+  const HdMeshTopology topology = makeGrid(2);
+
+  PrimvarSource source = { VtValue(VtVec3fArray(4, GfVec3f(1.0f, 0.0f, 0.0f))), HdInterpolationUniform };
+  EXPECT_TRUE(HdVP2WeldPrimvarSource(source, topology));
+  EXPECT_EQ(HdInterpolationConstant, source.interpolation);
+  EXPECT_EQ(VtVec3fArray(1, GfVec3f(1.0f, 0.0f, 0.0f)), source.data.Get<VtVec3fArray>());
+
+  VtVec3fArray colors(4, GfVec3f(1.0f, 0.0f, 0.0f));
+  colors[3] = GfVec3f(0.0f, 1.0f, 0.0f);
+  source = { VtValue(colors), HdInterpolationUniform };
+  EXPECT_FALSE(HdVP2WeldPrimvarSource(source, topology));
+  EXPECT_EQ(HdInterpolationUniform, source.interpolation);
+
+  // other interpolations are left alone
+  source = { VtValue(VtVec3fArray(9)), HdInterpolationVertex };
+  EXPECT_FALSE(HdVP2WeldPrimvarSource(source, topology));
+  EXPECT_EQ(HdInterpolationVertex, source.interpolation);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(MeshVertexLayout, layoutKeptForTopology)
+{
+  const HdMeshTopology topology = makeGrid(4);
+
+  PrimvarSourceMap welded;
+  welded[HdTokens->normals] = { VtValue(VtVec3fArray(25)), HdInterpolationVertex };
+  PrimvarSourceMap unshared = welded;
+  unshared[TfToken("st")] = { VtValue(VtVec2fArray(64)), HdInterpolationFaceVarying };
+
+  HdVP2MeshVertexLayout layout;
+  EXPECT_TRUE(layout.SetTopologyId(topology.ComputeHash()));
+  EXPECT_FALSE(layout.Update(welded));
+  EXPECT_FALSE(layout.IsUnshared());
+  EXPECT_TRUE(layout.ShouldWeldPrimvars());
+
+  EXPECT_TRUE(layout.Update(unshared));
+  EXPECT_TRUE(layout.IsUnshared());
+  EXPECT_FALSE(layout.ShouldWeldPrimvars());
+
+  // primvars becoming weldable again don't switch the layout back
+  EXPECT_FALSE(layout.Update(welded));
+  EXPECT_TRUE(layout.IsUnshared());
+  EXPECT_FALSE(layout.Update(unshared));
+
+  // neither does a topology marked dirty without changing
+  EXPECT_FALSE(layout.SetTopologyId(topology.ComputeHash()));
+  EXPECT_TRUE(layout.IsUnshared());
+
+  // a new topology starts over with the welded layout
+  EXPECT_TRUE(layout.SetTopologyId(makeGrid(5).ComputeHash()));
+  EXPECT_FALSE(layout.IsUnshared());
+  EXPECT_TRUE(layout.ShouldWeldPrimvars());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(MeshVertexLayout, vertexBufferSize)
+{
+  const HdMeshTopology topology = makeGrid(100);
+
+  // positions, normals and uvs
+  const size_t vertexSize = 2 * sizeof(GfVec3f) + sizeof(GfVec2f);
+
+  HdVP2MeshVertexLayout layout;
+  layout.SetTopologyId(topology.ComputeHash());
+  const size_t weldedVertices = layout.GetNumVertices(topology);
+  EXPECT_EQ(size_t(101 * 101), weldedVertices);
+
+  PrimvarSourceMap unshared;
+  unshared[TfToken("st")] = { VtValue(VtVec2fArray(40000)), HdInterpolationFaceVarying };
+  layout.Update(unshared);
+  const size_t unsharedVertices = layout.GetNumVertices(topology);
+  EXPECT_EQ(size_t(4 * 100 * 100), unsharedVertices);
+
+  // GPU memory and bytes uploaded per frame for a deforming mesh are almost
+  // four times smaller with the welded layout
+  const size_t weldedBytes = weldedVertices * vertexSize;
+  const size_t unsharedBytes = unsharedVertices * vertexSize;
+  EXPECT_EQ(size_t(326432), weldedBytes);
+  EXPECT_EQ(size_t(1280000), unsharedBytes);
+  EXPECT_GT(unsharedBytes, 3.9 * weldedBytes);
+}
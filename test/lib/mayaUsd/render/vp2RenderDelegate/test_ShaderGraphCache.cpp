@@ -0,0 +1,173 @@
+#include <shaderGraphCache.h>
+
+#include <pxr/base/tf/token.h>
+#include <pxr/base/vt/value.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+//----------------------------------------------------------------------------------------------------------------------
+// Preview surface with a texture read at a primvar, like UsdImagingMaterialAdapter emits it.
+HdMaterialNetwork makeNetwork(const std::string& material, float roughness, const std::string& file)
+{
+  const SdfPath materialPath("/" + material);
+  HdMaterialNetwork network;
+
+  HdMaterialNode reader;
+  reader.path = materialPath.AppendChild(TfToken("stReader"));
+  reader.identifier = TfToken("UsdPrimvarReader_float2");
+  reader.parameters[TfToken("varname")] = VtValue(TfToken("st"));
+  network.nodes.push_back(reader);
+
+  HdMaterialNode texture;
+  texture.path = materialPath.AppendChild(TfToken("diffuseTexture"));
+  texture.identifier = TfToken("UsdUVTexture");
+  texture.parameters[TfToken("file")] = VtValue(file);
+  network.nodes.push_back(texture);
+
+  HdMaterialNode surface;
+  surface.path = materialPath.AppendChild(TfToken("PreviewSurface"));
+  surface.identifier = TfToken("UsdPreviewSurface");
+  surface.parameters[TfToken("roughness")] = VtValue(roughness);
+  network.nodes.push_back(surface);
+
+  HdMaterialRelationship st;
+  st.inputId = reader.path;
+  st.inputName = TfToken("result");
+  st.outputId = texture.path;
+  st.outputName = TfToken("st");
+  network.relationships.push_back(st);
+
+  HdMaterialRelationship diffuse;
+  diffuse.inputId = texture.path;
+  diffuse.inputName = TfToken("rgb");
+  diffuse.outputId = surface.path;
+  diffuse.outputName = TfToken("diffuseColor");
+  network.relationships.push_back(diffuse);
+
+  return network;
+}
+
+struct FakeShader
+{
+  int generation = 0;
+};
+
+struct FakeShaderTraits
+{
+  static int clones;
+  static int releases;
+
+  static FakeShader* Clone(const FakeShader& shader)
+  {
+    ++clones;
+    FakeShader* clone = new FakeShader(shader);
+    ++clone->generation;
+    return clone;
+  }
+
+  static void Release(FakeShader* shader)
+  {
+    ++releases;
+    delete shader;
+  }
+};
+
+int FakeShaderTraits::clones = 0;
+int FakeShaderTraits::releases = 0;
+
+} // namespace
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(ShaderGraphCache, sameTopologySameKey)
+{
+  // parameter values and material paths don't change the graph
+  EXPECT_EQ(
+    HdVP2GetShaderGraphKey(makeNetwork("MaterialA", 0.1f, "a.png")),
+    HdVP2GetShaderGraphKey(makeNetwork("MaterialB", 0.9f, "b.png")));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(ShaderGraphCache, differentTopologyDifferentKey)
+{
+  const HdMaterialNetwork reference = makeNetwork("Material", 0.5f, "a.png");
+  const std::string referenceKey = HdVP2GetShaderGraphKey(reference);
+
+  // fragment
+  HdMaterialNetwork network = reference;
+  network.nodes[2].identifier = TfToken("UsdPreviewSurfaceOther");
+  EXPECT_NE(referenceKey, HdVP2GetShaderGraphKey(network));
+
+  // node names prefix the fragment parameters
+  network = reference;
+  network.nodes[1].path = SdfPath("/Material/otherTexture");
+  network.relationships[0].outputId = network.nodes[1].path;
+  network.relationships[1].inputId = network.nodes[1].path;
+  EXPECT_NE(referenceKey, HdVP2GetShaderGraphKey(network));
+
+  // primvar readers rename parameters after the primvar they read
+  network = reference;
+  network.nodes[0].parameters[TfToken("varname")] = VtValue(TfToken("uv2"));
+  EXPECT_NE(referenceKey, HdVP2GetShaderGraphKey(network));
+
+  // connected output
+  network = reference;
+  network.relationships[1].inputName = TfToken("r");
+  EXPECT_NE(referenceKey, HdVP2GetShaderGraphKey(network));
+
+  // connected input
+  network = reference;
+  network.relationships[1].outputName = TfToken("emissiveColor");
+  EXPECT_NE(referenceKey, HdVP2GetShaderGraphKey(network));
+
+  // missing connection
+  network = reference;
+  network.relationships.pop_back();
+  EXPECT_NE(referenceKey, HdVP2GetShaderGraphKey(network));
+
+  // connection between other nodes with the same names
+  network = reference;
+  network.relationships[1].inputId = network.nodes[0].path;
+  EXPECT_NE(referenceKey, HdVP2GetShaderGraphKey(network));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(ShaderGraphCache, acquireClonesPrototype)
+{
+  FakeShaderTraits::clones = 0;
+  FakeShaderTraits::releases = 0;
+
+  HdVP2ShaderGraphCache<FakeShader, FakeShaderTraits> cache;
+  const std::string key = HdVP2GetShaderGraphKey(makeNetwork("Material", 0.5f, "a.png"));
+
+  EXPECT_EQ(nullptr, cache.Acquire(key));
+
+  FakeShader built;
+  cache.Add(key, built);
+  EXPECT_EQ(1u, cache.Size());
+  EXPECT_EQ(1, FakeShaderTraits::clones);
+
+  // the first prototype is kept
+  cache.Add(key, built);
+  EXPECT_EQ(1u, cache.Size());
+  EXPECT_EQ(1, FakeShaderTraits::clones);
+
+  FakeShader* shader = cache.Acquire(key);
+  ASSERT_NE(nullptr, shader);
+  EXPECT_EQ(2, shader->generation);
+  EXPECT_EQ(2, FakeShaderTraits::clones);
+  delete shader;
+
+  EXPECT_EQ(nullptr, cache.Acquire(HdVP2GetShaderGraphKey(HdMaterialNetwork())));
+
+  cache.Clear();
+  EXPECT_EQ(0u, cache.Size());
+  EXPECT_EQ(1, FakeShaderTraits::releases);
+  EXPECT_EQ(nullptr, cache.Acquire(key));
+}
@@ -0,0 +1,141 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2020 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+from pxr import Gf
+from pxr import Vt
+
+from mayaUsd import lib as mayaUsdLib
+from maya import cmds
+from maya.api import OpenMaya
+
+import unittest
+
+try:
+    import numpy
+except ImportError:
+    numpy = None
+
+class MayaUsdMeshBuffersTestCase(unittest.TestCase):
+    """
+    Verify the bulk mesh accessors of mayaUsd.lib.MeshWriteUtils against the
+    Maya API.
+    """
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+        self.mesh = cmds.listRelatives(
+            cmds.polyPlane(width=2.0, height=3.0, subdivisionsX=4,
+                subdivisionsY=3)[0], shapes=True)[0]
+
+        selection = OpenMaya.MSelectionList()
+        selection.add(self.mesh)
+        self.meshFn = OpenMaya.MFnMesh(selection.getDagPath(0))
+
+    def testGetMeshPoints(self):
+        points = mayaUsdLib.MeshWriteUtils.GetMeshPoints(self.mesh)
+        self.assertIsInstance(points, Vt.Vec3fArray)
+
+        mayaPoints = self.meshFn.getPoints()
+        self.assertEqual(len(points), len(mayaPoints))
+        for point, mayaPoint in zip(points, mayaPoints):
+            self.assertTrue(Gf.IsClose(point,
+                Gf.Vec3f(mayaPoint.x, mayaPoint.y, mayaPoint.z), 1e-6))
+
+        # The result is readable through the buffer protocol.
+        view = memoryview(points)
+        self.assertEqual(view.format[-1], 'f')
+        self.assertEqual(view.shape, (len(points), 3))
+
+    def testGetMeshFaceVertexIndices(self):
+        (counts, indices) = mayaUsdLib.MeshWriteUtils.GetMeshFaceVertexIndices(
+            self.mesh)
+
+        (mayaCounts, mayaIndices) = self.meshFn.getVertices()
+        self.assertEqual(list(counts), list(mayaCounts))
+        self.assertEqual(list(indices), list(mayaIndices))
+
+    def testGetMeshUVs(self):
+        (uvs, uvIds) = mayaUsdLib.MeshWriteUtils.GetMeshUVs(self.mesh, 'map1')
+
+        (us, vs) = self.meshFn.getUVs('map1')
+        self.assertEqual(len(uvs), len(us))
+        for uv, u, v in zip(uvs, us, vs):
+            self.assertTrue(Gf.IsClose(uv, Gf.Vec2f(u, v), 1e-6))
+
+        faceVertex = 0
+        for face in range(self.meshFn.numPolygons):
+            for vertex in range(self.meshFn.polygonVertexCount(face)):
+                self.assertEqual(uvIds[faceVertex],
+                    self.meshFn.getPolygonUVid(face, vertex, 'map1'))
+                faceVertex += 1
+        self.assertEqual(len(uvIds), faceVertex)
+
+    def testSetMeshPoints(self):
+        points = mayaUsdLib.MeshWriteUtils.GetMeshPoints(self.mesh)
+        moved = Vt.Vec3fArray([p + Gf.Vec3f(0.0, 1.0, 0.0) for p in points])
+        self.assertTrue(
+            mayaUsdLib.MeshWriteUtils.SetMeshPoints(self.mesh, moved))
+
+        mayaPoints = self.meshFn.getPoints()
+        for point, mayaPoint in zip(moved, mayaPoints):
+            self.assertTrue(Gf.IsClose(point,
+                Gf.Vec3f(mayaPoint.x, mayaPoint.y, mayaPoint.z), 1e-6))
+
+        # Wrong number of points.
+        self.assertFalse(mayaUsdLib.MeshWriteUtils.SetMeshPoints(
+            self.mesh, Vt.Vec3fArray(list(moved)[1:])))
+
+        # Wrong value type.
+        self.assertFalse(mayaUsdLib.MeshWriteUtils.SetMeshPoints(
+            self.mesh, Vt.Vec3dArray([Gf.Vec3d(p) for p in points])))
+
+    def testSetMeshUVs(self):
+        (uvs, uvIds) = mayaUsdLib.MeshWriteUtils.GetMeshUVs(self.mesh, 'map1')
+        scaled = Vt.Vec2fArray([uv * 0.5 for uv in uvs])
+
+        # Leave the first face without UVs.
+        firstFaceCount = self.meshFn.polygonVertexCount(0)
+        ids = Vt.IntArray([-1] * firstFaceCount + list(uvIds)[firstFaceCount:])
+        self.assertTrue(mayaUsdLib.MeshWriteUtils.SetMeshUVs(
+            self.mesh, 'map1', scaled, ids))
+
+        (newUVs, newUVIds) = mayaUsdLib.MeshWriteUtils.GetMeshUVs(
+            self.mesh, 'map1')
+        self.assertEqual(list(newUVIds), list(ids))
+        for uv, newUV in zip(scaled, newUVs):
+            self.assertTrue(Gf.IsClose(uv, newUV, 1e-6))
+
+    @unittest.skipIf(numpy is None, 'numpy is not available')
+    def testNumpyRoundTrip(self):
+        points = mayaUsdLib.MeshWriteUtils.GetMeshPoints(self.mesh)
+
+        # No copy when viewing the result with numpy.
+        pointsView = numpy.asarray(points)
+        self.assertEqual(pointsView.shape, (len(points), 3))
+
+        moved = pointsView * 2.0
+        self.assertEqual(moved.dtype, numpy.float32)
+        self.assertTrue(
+            mayaUsdLib.MeshWriteUtils.SetMeshPoints(self.mesh, moved))
+        self.assertTrue(numpy.allclose(
+            numpy.asarray(mayaUsdLib.MeshWriteUtils.GetMeshPoints(self.mesh)),
+            moved))
+
+        (counts, indices) = mayaUsdLib.MeshWriteUtils.GetMeshFaceVertexIndices(
+            self.mesh)
+        self.assertEqual(int(numpy.asarray(counts).sum()), len(indices))
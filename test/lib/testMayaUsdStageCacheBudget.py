@@ -0,0 +1,149 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2020 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+from pxr import Sdf
+
+from mayaUsd import lib as mayaUsdLib
+
+import unittest
+
+class MayaUsdStageCacheBudgetTestCase(unittest.TestCase):
+    """
+    Verify the memory budget and eviction policy of mayaUsd.lib.StageCache
+    with in-memory stages.
+    """
+
+    def setUp(self):
+        mayaUsdLib.StageCache.SetMemoryBudget(0)
+        mayaUsdLib.StageCache.Clear()
+        mayaUsdLib.StageCache.ResetStatistics()
+
+    def tearDown(self):
+        mayaUsdLib.StageCache.SetMemoryBudget(0)
+        mayaUsdLib.StageCache.Clear()
+
+    def _createLayer(self, primCount=100):
+        layer = Sdf.Layer.CreateAnonymous('.usda')
+        for i in range(primCount):
+            Sdf.CreatePrimInLayer(layer, '/Prim%d' % i).specifier = Sdf.SpecifierDef
+        return layer
+
+    def _isCached(self, stage):
+        return mayaUsdLib.StageCache.Get(True).Contains(stage)
+
+    def testHitsAndMisses(self):
+        layer = self._createLayer()
+
+        stage = mayaUsdLib.StageCache.Open(layer)
+        self.assertTrue(stage)
+        self.assertTrue(self._isCached(stage))
+
+        self.assertEqual(mayaUsdLib.StageCache.Open(layer), stage)
+
+        stats = mayaUsdLib.StageCache.GetStatistics()
+        self.assertEqual(stats.hits, 1)
+        self.assertEqual(stats.misses, 1)
+        self.assertEqual(stats.evictions, 0)
+        self.assertGreater(stats.memoryUsage, 0)
+
+        mayaUsdLib.StageCache.ResetStatistics()
+        stats = mayaUsdLib.StageCache.GetStatistics()
+        self.assertEqual(stats.hits, 0)
+        self.assertEqual(stats.misses, 0)
+        self.assertGreater(stats.memoryUsage, 0)
+
+    def testNoBudget(self):
+        self.assertEqual(mayaUsdLib.StageCache.GetMemoryBudget(), 0)
+
+        stages = [mayaUsdLib.StageCache.Open(self._createLayer())
+                  for i in range(5)]
+
+        for stage in stages:
+            self.assertTrue(self._isCached(stage))
+        self.assertEqual(mayaUsdLib.StageCache.GetStatistics().evictions, 0)
+
+    def testLeastRecentlyUsedEviction(self):
+        layers = [self._createLayer() for i in range(3)]
+
+        stageA = mayaUsdLib.StageCache.Open(layers[0])
+        stageSize = mayaUsdLib.StageCache.GetStatistics().memoryUsage
+        stageB = mayaUsdLib.StageCache.Open(layers[1])
+
+        # Room for two stages only.
+        mayaUsdLib.StageCache.SetMemoryBudget(stageSize * 2 + stageSize // 2)
+        self.assertTrue(self._isCached(stageA))
+        self.assertTrue(self._isCached(stageB))
+
+        # Make B the least recently used one.
+        self.assertEqual(mayaUsdLib.StageCache.Open(layers[0]), stageA)
+
+        stageC = mayaUsdLib.StageCache.Open(layers[2])
+        self.assertTrue(self._isCached(stageA))
+        self.assertFalse(self._isCached(stageB))
+        self.assertTrue(self._isCached(stageC))
+        self.assertEqual(mayaUsdLib.StageCache.GetStatistics().evictions, 1)
+
+    def testStagesWithUsersAreKept(self):
+        layers = [self._createLayer() for i in range(3)]
+
+        stageA = mayaUsdLib.StageCache.Open(layers[0])
+        stageSize = mayaUsdLib.StageCache.GetStatistics().memoryUsage
+        mayaUsdLib.StageCache.AddStageUser(stageA)
+
+        mayaUsdLib.StageCache.SetMemoryBudget(stageSize + stageSize // 2)
+
+        stageB = mayaUsdLib.StageCache.Open(layers[1])
+        self.assertTrue(self._isCached(stageA))
+        self.assertTrue(self._isCached(stageB))
+
+        # B is now the only stage that can go.
+        stageC = mayaUsdLib.StageCache.Open(layers[2])
+        self.assertTrue(self._isCached(stageA))
+        self.assertFalse(self._isCached(stageB))
+        self.assertTrue(self._isCached(stageC))
+
+        # Once released, A can be evicted too.
+        mayaUsdLib.StageCache.RemoveStageUser(stageA)
+        mayaUsdLib.StageCache.SetMemoryBudget(stageSize // 2)
+        self.assertFalse(self._isCached(stageA))
+        self.assertFalse(self._isCached(stageC))
+        self.assertEqual(mayaUsdLib.StageCache.GetStatistics().evictions, 3)
+
+    def testDestroyedStageWithUsers(self):
+        stageA = mayaUsdLib.StageCache.Open(self._createLayer())
+        stageSize = mayaUsdLib.StageCache.GetStatistics().memoryUsage
+        mayaUsdLib.StageCache.AddStageUser(stageA)
+
+        # Destroy A without releasing it, as a proxy shape whose stage went
+        # away would.
+        mayaUsdLib.StageCache.Clear()
+        del stageA
+
+        # New stages, which may reuse A's memory, are not mistaken for A and
+        # are still evicted.
+        mayaUsdLib.StageCache.SetMemoryBudget(stageSize + stageSize // 2)
+        previous = mayaUsdLib.StageCache.Open(self._createLayer())
+        for i in range(10):
+            stage = mayaUsdLib.StageCache.Open(self._createLayer())
+            self.assertTrue(self._isCached(stage))
+            self.assertFalse(self._isCached(previous))
+            previous = stage
+        self.assertEqual(mayaUsdLib.StageCache.GetStatistics().evictions, 10)
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
@@ -18,7 +18,10 @@
 
 import maya.cmds as cmds
 
+from pxr import Tf, Usd
+
 from ufeTestUtils import usdUtils, mayaUtils
+import mayaUsd.ufe
 import ufe
 
 import unittest
@@ -186,3 +189,94 @@ class DuplicateCmdTestCase(unittest.TestCase):
 
         cmds.undo() # undo duplication
         cmds.undo() # undo deletion
+
+    def testDuplicateNames(self):
+        '''Duplicate names stay unique across repeated duplicates and undo.'''
+
+        ball35Path = ufe.Path([
+            mayaUtils.createUfePathSegment(
+                "|world|transform1|proxyShape1"),
+             usdUtils.createUfePathSegment("/Room_set/Props/Ball_35")])
+        ball35Item = ufe.Hierarchy.createItem(ball35Path)
+
+        # See testDuplicate for the choice of edit target.
+        stage = usdUtils.getPrimFromSceneItem(ball35Item).GetStage()
+        stage.SetEditTarget(stage.GetLayerStack()[2])
+
+        def duplicateBall35():
+            cmds.select(clear=True)
+            ufe.GlobalSelection.get().append(ball35Item)
+            cmds.duplicate()
+            return str(next(iter(ufe.GlobalSelection.get())).path().back())
+
+        # Each duplicate must see the previous ones, which were added since
+        # the sibling names of Props were first looked up.
+        self.assertEqual(
+            [duplicateBall35() for i in range(3)],
+            ["Ball_36", "Ball_37", "Ball_38"])
+
+        # Undo removes the duplicates, so their names can be used again.
+        for i in range(3):
+            cmds.undo()
+        self.assertFalse(stage.GetPrimAtPath("/Room_set/Props/Ball_36"))
+        self.assertEqual(duplicateBall35(), "Ball_36")
+        cmds.undo()
+
+    def testDuplicateLongSuffix(self):
+        '''Suffixes too long for an integer are incremented too.'''
+
+        stage = mayaUsd.ufe.getStage("|world|transform1|proxyShape1")
+        stage.SetEditTarget(stage.GetLayerStack()[2])
+        stage.DefinePrim("/Room_set/Props/Ball_99999999999")
+
+        longPath = ufe.Path([
+            mayaUtils.createUfePathSegment(
+                "|world|transform1|proxyShape1"),
+             usdUtils.createUfePathSegment("/Room_set/Props/Ball_99999999999")])
+        cmds.select(clear=True)
+        ufe.GlobalSelection.get().append(ufe.Hierarchy.createItem(longPath))
+        cmds.duplicate()
+
+        dupName = str(next(iter(ufe.GlobalSelection.get())).path().back())
+        self.assertEqual(dupName, "Ball_100000000000")
+        cmds.undo()
+
+    def testDuplicateSelection(self):
+        '''Duplicate many prims as a single command, with a single notice.'''
+
+        proxyShapePath = "|world|transform1|proxyShape1"
+        stage = mayaUsd.ufe.getStage(proxyShapePath)
+
+        # See testDuplicate for the choice of edit target.
+        stage.SetEditTarget(stage.GetLayerStack()[2])
+
+        nbNotices = [0]
+        def onObjectsChanged(notice, sender):
+            nbNotices[0] += 1
+        listener = Tf.Notice.Register(
+            Usd.Notice.ObjectsChanged, onObjectsChanged, stage)
+
+        balls = ["Ball_%d" % i for i in range(1, 6)]
+        cmd = mayaUsd.ufe.DuplicateSelectionCommand(
+            [proxyShapePath + ",/Room_set/Props/" + ball for ball in balls])
+
+        # The duplicates are named as if duplicated one after the other.
+        dupPaths = ["/Room_set/Props/Ball_%d" % i for i in range(36, 41)]
+
+        cmd.redo()
+        self.assertEqual(nbNotices[0], 1)
+        for dupPath in dupPaths:
+            self.assertTrue(stage.GetPrimAtPath(dupPath))
+
+        cmd.undo()
+        self.assertEqual(nbNotices[0], 2)
+        for dupPath in dupPaths:
+            self.assertFalse(stage.GetPrimAtPath(dupPath))
+
+        cmd.redo()
+        self.assertEqual(nbNotices[0], 3)
+        for dupPath in dupPaths:
+            self.assertTrue(stage.GetPrimAtPath(dupPath))
+
+        listener.Revoke()
+        cmd.undo()
@@ -0,0 +1,140 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2020 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+from pxr import Gf, Tf, Usd, UsdGeom
+
+from ufeTestUtils import mayaUtils
+from ufeTestUtils.testUtils import assertVectorAlmostEqual
+import mayaUsd.ufe
+
+import unittest
+
+class TRSBatchCmdTestCase(unittest.TestCase):
+    '''Verify that a TRS batch command transforms many prims as a single
+    undoable command, with a single notice per update.
+
+    UFE Feature : Transform3d
+    Maya Feature : move, scale
+    Action : Relative translate and scale of many prims.
+    Applied On Selection : No
+    Undo/Redo Test : Yes
+    Expect Results To Test :
+        - USD object translation and scale.
+        - Number of ObjectsChanged notices sent by the stage.
+    Edge Cases :
+        - None.
+    '''
+
+    pluginsLoaded = False
+
+    proxyShapePath = '|world|transform1|proxyShape1'
+    balls = ['Ball_%d' % i for i in range(1, 11)]
+
+    @classmethod
+    def setUpClass(cls):
+        if not cls.pluginsLoaded:
+            cls.pluginsLoaded = mayaUtils.isMayaUsdPluginLoaded()
+
+    def setUp(self):
+        ''' Called initially to set up the maya test environment '''
+        self.assertTrue(self.pluginsLoaded)
+
+        # Open top_layer.ma scene in test-samples
+        mayaUtils.openTopLayerScene()
+
+        self.stage = mayaUsd.ufe.getStage(self.proxyShapePath)
+        self.ufePaths = [self.proxyShapePath + ',/Room_set/Props/' + ball
+                         for ball in self.balls]
+        self.prims = [mayaUsd.ufe.ufePathToPrim(path) for path in self.ufePaths]
+
+        self.nbNotices = 0
+        self.listener = Tf.Notice.Register(
+            Usd.Notice.ObjectsChanged, self.onObjectsChanged, self.stage)
+
+    def tearDown(self):
+        self.listener.Revoke()
+
+    def onObjectsChanged(self, notice, sender):
+        self.nbNotices += 1
+
+    def xformVectors(self):
+        return [UsdGeom.XformCommonAPI(prim).GetXformVectors(
+            Usd.TimeCode.Default()) for prim in self.prims]
+
+    def assertTranslations(self, expected):
+        for vectors, translation in zip(self.xformVectors(), expected):
+            assertVectorAlmostEqual(self, vectors[0], translation)
+
+    def assertScales(self, expected):
+        for vectors, scale in zip(self.xformVectors(), expected):
+            assertVectorAlmostEqual(self, vectors[2], scale)
+
+    def testTranslate(self):
+        '''Translate many prims, e.g. for drag updates, then undo and redo.'''
+        initial = [vectors[0] for vectors in self.xformVectors()]
+
+        cmd = mayaUsd.ufe.TRSBatchCommand(
+            self.ufePaths, mayaUsd.ufe.TRSBatchCommand.Operation.Translate)
+        self.assertEqual(cmd.size(), len(self.balls))
+
+        # Each update of all the prims sends a single notice.
+        self.nbNotices = 0
+        for nb, offset in enumerate([Gf.Vec3d(1, 2, 3), Gf.Vec3d(4, 5, 6)], 1):
+            self.assertTrue(cmd.setRelative(*offset))
+            self.assertEqual(self.nbNotices, nb)
+            self.assertTranslations([t + offset for t in initial])
+
+        # A single undo restores all the prims, and so does redo.
+        cmd.undo()
+        self.assertEqual(self.nbNotices, 3)
+        self.assertTranslations(initial)
+
+        cmd.redo()
+        self.assertEqual(self.nbNotices, 4)
+        self.assertTranslations([t + Gf.Vec3d(4, 5, 6) for t in initial])
+
+        # Absolute values, one per prim.
+        values = [Gf.Vec3d(i, 0, 0) for i in range(len(self.balls))]
+        self.assertTrue(cmd.set(values))
+        self.assertEqual(self.nbNotices, 5)
+        self.assertTranslations(values)
+
+        cmd.undo()
+        self.assertEqual(self.nbNotices, 6)
+        self.assertTranslations(initial)
+
+    def testScale(self):
+        '''Scale many prims, then undo and redo.'''
+        initial = [vectors[2] for vectors in self.xformVectors()]
+        scaled = [Gf.CompMult(s, Gf.Vec3f(2, 3, 4)) for s in initial]
+
+        cmd = mayaUsd.ufe.TRSBatchCommand(
+            self.ufePaths, mayaUsd.ufe.TRSBatchCommand.Operation.Scale)
+
+        self.nbNotices = 0
+        self.assertTrue(cmd.setRelative(2, 3, 4))
+        self.assertEqual(self.nbNotices, 1)
+        self.assertScales(scaled)
+
+        cmd.undo()
+        self.assertEqual(self.nbNotices, 2)
+        self.assertScales(initial)
+
+        cmd.redo()
+        self.assertEqual(self.nbNotices, 3)
+        self.assertScales(scaled)
@@ -0,0 +1,119 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <mayaUsd/fileio/chaser/chaser.h>
+#include <mayaUsd/fileio/chaser/chaserRegistry.h>
+
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/types.h>
+#include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <maya/MDagPath.h>
+#include <maya/MFn.h>
+#include <maya/MMatrix.h>
+
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// Concurrent chaser which authors a value computed from the world matrix of
+// every exported transform, for testing the concurrent chaser dispatch.
+class ConcurrentTestChaser : public UsdMayaChaser
+{
+public:
+    enum Value { kDistance, kHeight };
+
+    ConcurrentTestChaser(const UsdMayaChaserRegistry::FactoryContext& ctx, Value value)
+        : _stage(ctx.GetStage())
+        , _value(value)
+        , _attrName(value == kDistance ? "userProperties:distance" : "userProperties:height")
+    {
+        for (const auto& entry : ctx.GetDagToUsdMap()) {
+            if (entry.first.hasFn(MFn::kTransform)) {
+                _dagPaths.push_back(entry.first);
+                _usdPaths.push_back(entry.second);
+            }
+        }
+    }
+
+    bool IsConcurrent() const override { return true; }
+
+    bool ExportFrame(const UsdTimeCode& time) override
+    {
+        // Maya data is only read on the main thread.
+        _matrices.resize(_dagPaths.size());
+        for (size_t i = 0; i < _dagPaths.size(); ++i) {
+            _matrices[i] = GfMatrix4d(_dagPaths[i].inclusiveMatrix().matrix);
+        }
+        return true;
+    }
+
+    bool ComputeFrame(const UsdTimeCode& time) override
+    {
+        _values.resize(_matrices.size());
+        for (size_t i = 0; i < _matrices.size(); ++i) {
+            const GfVec3d position = _matrices[i].ExtractTranslation();
+            _values[i] = (_value == kDistance) ? position.GetLength() : position[1];
+        }
+        return true;
+    }
+
+    bool AuthorFrame(const UsdTimeCode& time) override
+    {
+        for (size_t i = 0; i < _usdPaths.size(); ++i) {
+            UsdPrim prim = _stage->GetPrimAtPath(_usdPaths[i]);
+            if (!prim) {
+                continue;
+            }
+            UsdAttribute attr = prim.CreateAttribute(
+                TfToken(_attrName), SdfValueTypeNames->Double, /* custom = */ true);
+            attr.Set(_values[i], time);
+        }
+        return true;
+    }
+
+private:
+    UsdStagePtr              _stage;
+    Value                    _value;
+    std::string              _attrName;
+    std::vector<MDagPath>    _dagPaths;
+    SdfPathVector            _usdPaths;
+    std::vector<GfMatrix4d>  _matrices;
+    std::vector<double>      _values;
+};
+
+} // namespace
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+PXRUSDMAYA_DEFINE_CHASER_FACTORY(testConcurrentDistance, ctx)
+{
+    return new ConcurrentTestChaser(ctx, ConcurrentTestChaser::kDistance);
+}
+
+PXRUSDMAYA_DEFINE_CHASER_FACTORY(testConcurrentHeight, ctx)
+{
+    return new ConcurrentTestChaser(ctx, ConcurrentTestChaser::kHeight);
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
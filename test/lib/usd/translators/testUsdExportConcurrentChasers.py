@@ -0,0 +1,95 @@
+#!/pxrpythonsubst
+#
+# Copyright 2020 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import os
+import unittest
+
+from maya import cmds
+from maya import standalone
+
+from pxr import Gf
+from pxr import Usd
+
+import fixturesUtils
+
+class testUsdExportConcurrentChasers(unittest.TestCase):
+    """
+    Exports with the concurrent chasers of the test plugin, which compute
+    frames on worker threads, and checks that the output is deterministic.
+    """
+
+    START_FRAME = 1
+    END_FRAME = 20
+    NUM_LOCATORS = 50
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__)
+        cmds.loadPlugin('usdTestPlugin')
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+
+        for i in range(self.NUM_LOCATORS):
+            locator = cmds.spaceLocator(name='Locator%d' % i)[0]
+            cmds.setKeyframe(locator, attribute='translateY',
+                time=self.START_FRAME, value=0.0)
+            cmds.setKeyframe(locator, attribute='translateY',
+                time=self.END_FRAME, value=float(i))
+            cmds.setAttr('%s.translateX' % locator, 1.0)
+
+    def _export(self, fileName):
+        usdFilePath = os.path.abspath(fileName)
+        cmds.mayaUSDExport(mergeTransformAndShape=True, file=usdFilePath,
+            shadingMode='none',
+            frameRange=(self.START_FRAME, self.END_FRAME),
+            chaser=['testConcurrentDistance', 'testConcurrentHeight'])
+        return usdFilePath
+
+    def testDeterministicOutput(self):
+        firstPath = self._export('UsdExportConcurrentChasers_1.usda')
+        secondPath = self._export('UsdExportConcurrentChasers_2.usda')
+
+        with open(firstPath) as first, open(secondPath) as second:
+            self.assertEqual(first.read(), second.read())
+
+        stage = Usd.Stage.Open(firstPath)
+        self.assertTrue(stage)
+
+        for i in range(self.NUM_LOCATORS):
+            prim = stage.GetPrimAtPath('/Locator%d' % i)
+            self.assertTrue(prim)
+            distance = prim.GetAttribute('userProperties:distance')
+            height = prim.GetAttribute('userProperties:height')
+            self.assertEqual(len(distance.GetTimeSamples()),
+                self.END_FRAME - self.START_FRAME + 1)
+            self.assertEqual(len(height.GetTimeSamples()),
+                self.END_FRAME - self.START_FRAME + 1)
+
+            # Each frame gets the values computed for that frame.
+            self.assertTrue(Gf.IsClose(height.Get(self.END_FRAME), i, 1e-6))
+            self.assertTrue(Gf.IsClose(distance.Get(self.END_FRAME),
+                Gf.Vec2d(1.0, i).GetLength(), 1e-6))
+            self.assertTrue(Gf.IsClose(height.Get(self.START_FRAME), 0.0, 1e-6))
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
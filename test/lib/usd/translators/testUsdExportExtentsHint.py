@@ -0,0 +1,171 @@
+#!/pxrpythonsubst
+#
+# Copyright 2020 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import os
+import unittest
+
+from maya import cmds
+from maya import standalone
+from maya.api import OpenMaya
+
+from pxr import Gf
+from pxr import Usd
+from pxr import UsdGeom
+
+import fixturesUtils
+
+class testUsdExportExtentsHint(unittest.TestCase):
+    """
+    Exports animated models and checks that their extentsHint matches the
+    computed bounds at every time sample, that a static model only gets a
+    default value, and that a proxy shape gives the same bounds whether it
+    uses the hints or not.
+    """
+
+    START_FRAME = 1
+    END_FRAME = 10
+    NUM_MODELS = 20
+    NUM_CUBES_PER_MODEL = 100
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__)
+
+        cmds.file(new=True, force=True)
+        cls.modelNames = []
+        for i in range(cls.NUM_MODELS):
+            cubes = []
+            for j in range(cls.NUM_CUBES_PER_MODEL):
+                cube = cmds.polyCube(name='Cube_%d_%d' % (i, j))[0]
+                cmds.move(float(i), float(j), 0.0, cube)
+                cubes.append(cube)
+            cls.modelNames.append(
+                cmds.group(cubes, name='Model_%d' % i, world=True))
+
+            # Animate one cube of the model so that its bounds change.
+            cmds.setKeyframe(cubes[-1], attribute='translateZ',
+                time=cls.START_FRAME, value=0.0)
+            cmds.setKeyframe(cubes[-1], attribute='translateZ',
+                time=cls.END_FRAME, value=float(i + 1))
+
+        cls.staticModelName = cmds.group(
+            [cmds.polyCube(name='StaticCube_%d' % j)[0] for j in range(3)],
+            name='StaticModel', world=True)
+
+        cls.usdFilePath = os.path.abspath('UsdExportExtentsHint.usda')
+        cmds.mayaUSDExport(mergeTransformAndShape=True,
+            file=cls.usdFilePath, shadingMode='none', kind='component',
+            frameRange=(cls.START_FRAME, cls.END_FRAME))
+
+        # Same stage, without the hints, for the proxy shape to compute
+        # bounds from every gprim.
+        cls.unhintedUsdFilePath = os.path.abspath(
+            'UsdExportExtentsHint_unhinted.usda')
+        stage = Usd.Stage.Open(cls.usdFilePath)
+        for modelName in cls.modelNames + [cls.staticModelName]:
+            stage.GetPrimAtPath('/' + modelName).RemoveProperty('extentsHint')
+        stage.GetRootLayer().Export(cls.unhintedUsdFilePath)
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    def _assertRangesClose(self, expected, actual):
+        self.assertEqual(expected.IsEmpty(), actual.IsEmpty())
+        if not expected.IsEmpty():
+            self.assertTrue(Gf.IsClose(expected.GetMin(), actual.GetMin(), 1e-5))
+            self.assertTrue(Gf.IsClose(expected.GetMax(), actual.GetMax(), 1e-5))
+
+    def testExtentsHintMatchesComputedBounds(self):
+        stage = Usd.Stage.Open(self.usdFilePath)
+        self.assertTrue(stage)
+
+        frames = range(self.START_FRAME, self.END_FRAME + 1)
+        for modelName in self.modelNames:
+            prim = stage.GetPrimAtPath('/' + modelName)
+            self.assertTrue(prim.IsModel())
+
+            extentsHintAttr = UsdGeom.ModelAPI(prim).GetExtentsHintAttr()
+            self.assertTrue(extentsHintAttr.HasAuthoredValue())
+            self.assertEqual(extentsHintAttr.GetTimeSamples(), list(frames))
+
+            for frame in frames:
+                bboxCache = UsdGeom.BBoxCache(frame,
+                    UsdGeom.Imageable.GetOrderedPurposeTokens(),
+                    useExtentsHint=False)
+                computed = bboxCache.ComputeUntransformedBound(
+                    prim).ComputeAlignedRange()
+
+                extentsHint = extentsHintAttr.Get(frame)
+                self._assertRangesClose(computed,
+                    Gf.Range3d(Gf.Vec3d(extentsHint[0]),
+                        Gf.Vec3d(extentsHint[1])))
+
+            # Models below the roots don't get a hint.
+            for child in prim.GetChildren():
+                self.assertFalse(
+                    child.GetAttribute('extentsHint').HasAuthoredValue())
+
+    def testStaticModelHasSingleValue(self):
+        stage = Usd.Stage.Open(self.usdFilePath)
+        prim = stage.GetPrimAtPath('/' + self.staticModelName)
+        self.assertTrue(prim.IsModel())
+
+        extentsHintAttr = UsdGeom.ModelAPI(prim).GetExtentsHintAttr()
+        self.assertTrue(extentsHintAttr.HasAuthoredValue())
+        self.assertEqual(extentsHintAttr.GetNumTimeSamples(), 0)
+
+        bboxCache = UsdGeom.BBoxCache(Usd.TimeCode.Default(),
+            UsdGeom.Imageable.GetOrderedPurposeTokens(),
+            useExtentsHint=False)
+        computed = bboxCache.ComputeUntransformedBound(
+            prim).ComputeAlignedRange()
+        extentsHint = extentsHintAttr.Get()
+        self._assertRangesClose(computed,
+            Gf.Range3d(Gf.Vec3d(extentsHint[0]), Gf.Vec3d(extentsHint[1])))
+
+    def _proxyBounds(self, usdFilePath):
+        shapeNode = cmds.createNode('mayaUsdProxyShape')
+        cmds.setAttr(shapeNode + '.filePath', usdFilePath, type='string')
+
+        selection = OpenMaya.MSelectionList()
+        selection.add(shapeNode)
+        shapeFn = OpenMaya.MFnDagNode(selection.getDagPath(0))
+
+        bounds = []
+        for frame in range(self.START_FRAME, self.END_FRAME + 1):
+            cmds.setAttr(shapeNode + '.time', frame)
+            boundingBox = shapeFn.boundingBox
+            bounds.append(Gf.Range3d(
+                Gf.Vec3d(boundingBox.min.x, boundingBox.min.y, boundingBox.min.z),
+                Gf.Vec3d(boundingBox.max.x, boundingBox.max.y, boundingBox.max.z)))
+
+        cmds.delete(cmds.listRelatives(shapeNode, parent=True))
+        return bounds
+
+    def testProxyShapeBoundsFromExtentsHint(self):
+        hintedBounds = self._proxyBounds(self.usdFilePath)
+        computedBounds = self._proxyBounds(self.unhintedUsdFilePath)
+
+        self.assertEqual(len(hintedBounds), len(computedBounds))
+        for hinted, computed in zip(hintedBounds, computedBounds):
+            self.assertFalse(computed.IsEmpty())
+            self._assertRangesClose(computed, hinted)
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
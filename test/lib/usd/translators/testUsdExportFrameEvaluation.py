@@ -0,0 +1,144 @@
+#!/pxrpythonsubst
+#
+# Copyright 2020 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import os
+import timeit
+import unittest
+
+from maya import cmds
+from maya import standalone
+
+from pxr import Gf
+from pxr import Usd
+from pxr import UsdGeom
+
+import fixturesUtils
+
+class testUsdExportFrameEvaluation(unittest.TestCase):
+    """
+    Exports an animated skinned mesh with each frameEvaluation mode, checks
+    that both give the same data and reports the wall time per frame.
+    """
+
+    START_FRAME = 1
+    END_FRAME = 100
+    NUM_JOINTS = 10
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__)
+
+        cmds.file(new=True, force=True)
+        cls._createRiggedCharacter()
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    @classmethod
+    def _createRiggedCharacter(cls):
+        height = 2.0 * cls.NUM_JOINTS
+        mesh = cmds.polyCylinder(name='Body', radius=1.0, height=height,
+            subdivisionsX=64, subdivisionsY=20 * cls.NUM_JOINTS)[0]
+        cmds.move(0.0, height / 2.0, 0.0, mesh)
+
+        cmds.select(clear=True)
+        joints = [cmds.joint(position=(0.0, 2.0 * i, 0.0))
+            for i in range(cls.NUM_JOINTS + 1)]
+        cmds.skinCluster(joints[0], mesh, toSelectedBones=False)
+
+        for i, joint in enumerate(joints[1:]):
+            for frame, angle in ((cls.START_FRAME, 0.0),
+                    ((cls.START_FRAME + cls.END_FRAME) / 2, 30.0 + i),
+                    (cls.END_FRAME, -20.0 - i)):
+                cmds.setKeyframe(joint, attribute='rotateZ', time=frame,
+                    value=angle)
+
+        cmds.currentTime(cls.START_FRAME)
+        cls.meshName = mesh
+
+    def _export(self, frameEvaluation):
+        usdFilePath = os.path.abspath(
+            'UsdExportFrameEvaluation_%s.usda' % frameEvaluation)
+
+        start = timeit.default_timer()
+        cmds.mayaUSDExport(mergeTransformAndShape=True, file=usdFilePath,
+            shadingMode='none',
+            frameRange=(self.START_FRAME, self.END_FRAME),
+            frameEvaluation=frameEvaluation)
+        elapsed = timeit.default_timer() - start
+
+        numFrames = self.END_FRAME - self.START_FRAME + 1
+        print('frameEvaluation=%s: %f ms per frame' %
+            (frameEvaluation, 1000.0 * elapsed / numFrames))
+
+        stage = Usd.Stage.Open(usdFilePath)
+        self.assertTrue(stage)
+        return stage
+
+    def testFrameEvaluationModes(self):
+        viewFrameStage = self._export('viewFrame')
+        dgContextStage = self._export('dgContext')
+
+        # The DG context export must not change the current time.
+        self.assertEqual(cmds.currentTime(query=True), self.START_FRAME)
+
+        meshPath = '/%s' % self.meshName
+        viewFramePoints = UsdGeom.Mesh.Get(
+            viewFrameStage, meshPath).GetPointsAttr()
+        dgContextPoints = UsdGeom.Mesh.Get(
+            dgContextStage, meshPath).GetPointsAttr()
+
+        self.assertEqual(viewFramePoints.GetTimeSamples(),
+            dgContextPoints.GetTimeSamples())
+        for frame in viewFramePoints.GetTimeSamples():
+            expected = viewFramePoints.Get(frame)
+            actual = dgContextPoints.Get(frame)
+            self.assertEqual(len(expected), len(actual))
+            for e, a in zip(expected, actual):
+                self.assertTrue(Gf.IsClose(e, a, 1e-5))
+
+    def testPerFrameCallbackTime(self):
+        """
+        Per-frame callbacks see the sample as the current time in both modes,
+        and the current time is set back after the export.
+        """
+        optionVar = 'testUsdExportFrameEvaluationTimes'
+        callback = ('from maya import cmds; '
+            'cmds.optionVar(floatValueAppend=("%s", '
+            'cmds.currentTime(query=True)))' % optionVar)
+        endFrame = self.START_FRAME + 4
+
+        for frameEvaluation in ('viewFrame', 'dgContext'):
+            cmds.optionVar(remove=optionVar)
+            usdFilePath = os.path.abspath(
+                'UsdExportFrameEvaluationCallback_%s.usda' % frameEvaluation)
+            cmds.mayaUSDExport(mergeTransformAndShape=True, file=usdFilePath,
+                shadingMode='none',
+                frameRange=(self.START_FRAME, endFrame),
+                frameEvaluation=frameEvaluation,
+                pythonPerFrameCallback=callback)
+
+            self.assertEqual(cmds.optionVar(query=optionVar),
+                [float(f) for f in range(self.START_FRAME, endFrame + 1)])
+            self.assertEqual(cmds.currentTime(query=True), self.START_FRAME)
+
+        cmds.optionVar(remove=optionVar)
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
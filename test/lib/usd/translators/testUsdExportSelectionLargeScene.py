@@ -0,0 +1,118 @@
+#!/pxrpythonsubst
+#
+# Copyright 2020 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import os
+import timeit
+import unittest
+
+from maya import cmds
+from maya import standalone
+
+from pxr import Usd
+
+import fixturesUtils
+
+class testUsdExportSelectionLargeScene(unittest.TestCase):
+    """
+    Exports selections of a large scene. The export only traverses the DAG
+    from the selected roots, so exporting a few roots of a large scene must
+    only write those roots and their ancestors, and take a fraction of the
+    time of a whole scene export.
+    """
+
+    NUM_GROUPS = 100
+    NUM_CHILDREN = 100
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__)
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+
+        self.groups = []
+        for i in range(self.NUM_GROUPS):
+            group = cmds.createNode('transform', name='Group%d' % i)
+            for j in range(self.NUM_CHILDREN):
+                cmds.createNode('transform', name='Child%d_%d' % (i, j),
+                    parent=group)
+            self.groups.append(group)
+
+    def _export(self, selection, fileName):
+        cmds.select(selection)
+        usdFilePath = os.path.abspath(fileName)
+        start = timeit.default_timer()
+        cmds.mayaUSDExport(selection=True, file=usdFilePath, shadingMode='none')
+        elapsed = timeit.default_timer() - start
+        return usdFilePath, elapsed
+
+    def testExportLargeSelection(self):
+        # Select half of the children of every group, i.e. 5000 roots.
+        selection = ['|Group%d|Child%d_%d' % (i, i, j)
+            for i in range(self.NUM_GROUPS)
+            for j in range(0, self.NUM_CHILDREN, 2)]
+
+        usdFilePath, _ = self._export(selection,
+            'UsdExportSelectionLargeScene_LARGE.usda')
+
+        stage = Usd.Stage.Open(usdFilePath)
+        self.assertTrue(stage)
+
+        groupPrims = stage.GetPseudoRoot().GetChildren()
+        self.assertEqual(len(groupPrims), self.NUM_GROUPS)
+        for i, groupPrim in enumerate(groupPrims):
+            # Siblings are written in the same order as in Maya.
+            self.assertEqual(groupPrim.GetName(), 'Group%d' % i)
+            childNames = [child.GetName() for child in groupPrim.GetChildren()]
+            self.assertEqual(childNames, ['Child%d_%d' % (i, j)
+                for j in range(0, self.NUM_CHILDREN, 2)])
+
+    def testExportSmallSelectionOfLargeScene(self):
+        usdFilePath, elapsedAll = self._export(self.groups,
+            'UsdExportSelectionLargeScene_ALL.usda')
+
+        stage = Usd.Stage.Open(usdFilePath)
+        self.assertTrue(stage)
+        self.assertEqual(len(list(stage.TraverseAll())),
+            self.NUM_GROUPS * (self.NUM_CHILDREN + 1))
+
+        usdFilePath, elapsedFew = self._export(['Child0_0', 'Child50_50'],
+            'UsdExportSelectionLargeScene_FEW.usda')
+
+        # The bound is generous, the fixed cost of an export is the same for
+        # both and timings vary across machines.
+        self.assertLess(elapsedFew, 0.5 * elapsedAll)
+
+        # Nothing else than the selected roots and their ancestors is written,
+        # not even as overs.
+        stage = Usd.Stage.Open(usdFilePath)
+        self.assertTrue(stage)
+        self.assertEqual(
+            [prim.GetPath().pathString for prim in stage.TraverseAll()],
+            ['/Group0', '/Group0/Child0_0', '/Group50', '/Group50/Child50_50'])
+        self.assertEqual(
+            [spec.path.pathString
+                for spec in stage.GetRootLayer().rootPrims],
+            ['/Group0', '/Group50'])
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
@@ -0,0 +1,103 @@
+#include <mayaUsdUtils/ArrayConversion.h>
+
+#include <pxr/base/gf/rotation.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec3f.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(ArrayConversion, convertDoubleToFloat)
+{
+  // cover the SIMD blocks as well as every possible remainder
+  for(size_t count = 0; count < 21; ++count)
+  {
+    std::vector<double> input(count);
+    for(size_t i = 0; i < count; ++i)
+    {
+      input[i] = double(i) * 1.25 - 7.0;
+    }
+
+    std::vector<float> output(count + 1, -1.0f);
+    MayaUsdUtils::convertDoubleToFloat(output.data(), input.data(), count);
+    for(size_t i = 0; i < count; ++i)
+    {
+      EXPECT_EQ(float(input[i]), output[i]);
+    }
+    // nothing should be written past the end
+    EXPECT_EQ(-1.0f, output[count]);
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(ArrayConversion, convertDoubleToInt64)
+{
+  const std::vector<double> input = { 0.0, 1.9, -1.9, 42.0, 3.5e9, -3.5e9, 7.0 };
+  std::vector<int64_t> output(input.size());
+  MayaUsdUtils::convertDoubleToInt64(output.data(), input.data(), input.size());
+  for(size_t i = 0; i < input.size(); ++i)
+  {
+    EXPECT_EQ(int64_t(input[i]), output[i]);
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(ArrayConversion, convertInt32ToInt64)
+{
+  for(size_t count = 0; count < 13; ++count)
+  {
+    std::vector<int32_t> input(count);
+    for(size_t i = 0; i < count; ++i)
+    {
+      input[i] = (i & 1) ? -int32_t(i) * 100000 : int32_t(i);
+    }
+
+    std::vector<int64_t> output(count + 1, -1);
+    MayaUsdUtils::convertInt32ToInt64(output.data(), input.data(), count);
+    for(size_t i = 0; i < count; ++i)
+    {
+      EXPECT_EQ(int64_t(input[i]), output[i]);
+    }
+    EXPECT_EQ(-1, output[count]);
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TEST(ArrayConversion, convertEulerXYZToQuath)
+{
+  const std::vector<double> input = {
+    0.0, 0.0, 0.0,
+    90.0, 0.0, 0.0,
+    0.0, 90.0, 0.0,
+    0.0, 0.0, 90.0,
+    30.0, 45.0, 60.0,
+    -120.0, 10.0, 200.0,
+    359.0, -270.0, 15.5,
+  };
+  const size_t count = input.size() / 3;
+
+  std::vector<GfQuath> output(count);
+  MayaUsdUtils::convertEulerXYZToQuath(output.data(), input.data(), count);
+
+  for(size_t i = 0; i < count; ++i)
+  {
+    const double* euler = input.data() + 3 * i;
+    const GfRotation rot = GfRotation(GfVec3d::XAxis(), euler[0])
+                         * GfRotation(GfVec3d::YAxis(), euler[1])
+                         * GfRotation(GfVec3d::ZAxis(), euler[2]);
+    const GfQuath expected(rot.GetQuat());
+
+    // q and -q describe the same rotation
+    const float sign = (float(expected.GetReal()) * float(output[i].GetReal()) +
+                        GfDot(GfVec3f(expected.GetImaginary()), GfVec3f(output[i].GetImaginary()))) < 0.0f ? -1.0f : 1.0f;
+    EXPECT_NEAR(float(expected.GetReal()), sign * float(output[i].GetReal()), 2e-3f);
+    for(int j = 0; j < 3; ++j)
+    {
+      EXPECT_NEAR(float(expected.GetImaginary()[j]), sign * float(output[i].GetImaginary()[j]), 2e-3f);
+    }
+  }
+}